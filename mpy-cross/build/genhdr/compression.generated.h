@@ -0,0 +1,3 @@
+const uint8_t lengths[] = { 0, 0, 1, 8, 6, 5, 7, 4, 9, 14, 12, 5, 6, 0 };
+const uint8_t values[] = { 32, 97, 101, 105, 110, 111, 114, 115, 116, 95, 99, 100, 108, 112, 117, 39, 98, 102, 103, 109, 37, 69, 104, 118, 119, 120, 121, 78, 106, 107, 113, 40, 41, 45, 65, 73, 79, 82, 83, 84, 42, 44, 47, 48, 58, 60, 62, 67, 68, 70, 77, 80, 85, 122, 35, 46, 49, 50, 51, 61, 66, 71, 72, 76, 86, 125, 10, 13, 34, 75, 123, 54, 56, 59, 88, 89, 90 };
+#define compress_max_length_bits (7)
@@ -0,0 +1,284 @@
+// This file was automatically generated by makeqstrdata.py
+
+QENUM(MP_QSTR_NULL)
+QENUM(MP_QSTR_)
+QENUM(MP_QSTR___add__)
+QENUM(MP_QSTR___aenter__)
+QENUM(MP_QSTR___aexit__)
+QENUM(MP_QSTR___aiter__)
+QENUM(MP_QSTR___anext__)
+QENUM(MP_QSTR___bool__)
+QENUM(MP_QSTR___build_class__)
+QENUM(MP_QSTR___bytes__)
+QENUM(MP_QSTR___call__)
+QENUM(MP_QSTR___class__)
+QENUM(MP_QSTR___contains__)
+QENUM(MP_QSTR___delitem__)
+QENUM(MP_QSTR___dict__)
+QENUM(MP_QSTR___enter__)
+QENUM(MP_QSTR___eq__)
+QENUM(MP_QSTR___exit__)
+QENUM(MP_QSTR___ge__)
+QENUM(MP_QSTR___getattr__)
+QENUM(MP_QSTR___getitem__)
+QENUM(MP_QSTR___gt__)
+QENUM(MP_QSTR___hash__)
+QENUM(MP_QSTR___iadd__)
+QENUM(MP_QSTR___import__)
+QENUM(MP_QSTR___init__)
+QENUM(MP_QSTR___isub__)
+QENUM(MP_QSTR___iter__)
+QENUM(MP_QSTR___le__)
+QENUM(MP_QSTR___len__)
+QENUM(MP_QSTR___lt__)
+QENUM(MP_QSTR___main__)
+QENUM(MP_QSTR___module__)
+QENUM(MP_QSTR___name__)
+QENUM(MP_QSTR___new__)
+QENUM(MP_QSTR___next__)
+QENUM(MP_QSTR___path__)
+QENUM(MP_QSTR___qualname__)
+QENUM(MP_QSTR___repl_print__)
+QENUM(MP_QSTR___repr__)
+QENUM(MP_QSTR___reversed__)
+QENUM(MP_QSTR___setitem__)
+QENUM(MP_QSTR___str__)
+QENUM(MP_QSTR___sub__)
+QENUM(MP_QSTR___traceback__)
+QENUM(MP_QSTR__star_)
+QENUM(MP_QSTR__)
+QENUM(MP_QSTR__slash_)
+QENUM(MP_QSTR__percent__hash_o)
+QENUM(MP_QSTR__percent__hash_x)
+QENUM(MP_QSTR__brace_open__colon__hash_b_brace_close_)
+QENUM(MP_QSTR__space_)
+QENUM(MP_QSTR__0x0a_)
+QENUM(MP_QSTR_maximum_space_recursion_space_depth_space_exceeded)
+QENUM(MP_QSTR__lt_module_gt_)
+QENUM(MP_QSTR__lt_lambda_gt_)
+QENUM(MP_QSTR__lt_listcomp_gt_)
+QENUM(MP_QSTR__lt_dictcomp_gt_)
+QENUM(MP_QSTR__lt_setcomp_gt_)
+QENUM(MP_QSTR__lt_genexpr_gt_)
+QENUM(MP_QSTR__lt_string_gt_)
+QENUM(MP_QSTR__lt_stdin_gt_)
+QENUM(MP_QSTR_utf_hyphen_8)
+QENUM(MP_QSTR_ArithmeticError)
+QENUM(MP_QSTR_AssertionError)
+QENUM(MP_QSTR_AttributeError)
+QENUM(MP_QSTR_BaseException)
+QENUM(MP_QSTR_EACCES)
+QENUM(MP_QSTR_EADDRINUSE)
+QENUM(MP_QSTR_EAGAIN)
+QENUM(MP_QSTR_EALREADY)
+QENUM(MP_QSTR_EBADF)
+QENUM(MP_QSTR_ECONNABORTED)
+QENUM(MP_QSTR_ECONNREFUSED)
+QENUM(MP_QSTR_ECONNRESET)
+QENUM(MP_QSTR_EEXIST)
+QENUM(MP_QSTR_EHOSTUNREACH)
+QENUM(MP_QSTR_EINPROGRESS)
+QENUM(MP_QSTR_EINVAL)
+QENUM(MP_QSTR_EIO)
+QENUM(MP_QSTR_EISDIR)
+QENUM(MP_QSTR_ENOBUFS)
+QENUM(MP_QSTR_ENODEV)
+QENUM(MP_QSTR_ENOENT)
+QENUM(MP_QSTR_ENOMEM)
+QENUM(MP_QSTR_ENOTCONN)
+QENUM(MP_QSTR_EOFError)
+QENUM(MP_QSTR_EOPNOTSUPP)
+QENUM(MP_QSTR_EPERM)
+QENUM(MP_QSTR_ETIMEDOUT)
+QENUM(MP_QSTR_Ellipsis)
+QENUM(MP_QSTR_Exception)
+QENUM(MP_QSTR_GeneratorExit)
+QENUM(MP_QSTR_ImportError)
+QENUM(MP_QSTR_IndentationError)
+QENUM(MP_QSTR_IndexError)
+QENUM(MP_QSTR_KeyError)
+QENUM(MP_QSTR_KeyboardInterrupt)
+QENUM(MP_QSTR_LookupError)
+QENUM(MP_QSTR_MemoryError)
+QENUM(MP_QSTR_MpyError)
+QENUM(MP_QSTR_NameError)
+QENUM(MP_QSTR_NoneType)
+QENUM(MP_QSTR_NotImplementedError)
+QENUM(MP_QSTR_OSError)
+QENUM(MP_QSTR_OverflowError)
+QENUM(MP_QSTR_ReloadException)
+QENUM(MP_QSTR_RuntimeError)
+QENUM(MP_QSTR_StopAsyncIteration)
+QENUM(MP_QSTR_StopIteration)
+QENUM(MP_QSTR_SyntaxError)
+QENUM(MP_QSTR_SystemExit)
+QENUM(MP_QSTR_TimeoutError)
+QENUM(MP_QSTR_TypeError)
+QENUM(MP_QSTR_UnicodeError)
+QENUM(MP_QSTR_ValueError)
+QENUM(MP_QSTR_ZeroDivisionError)
+QENUM(MP_QSTR_abs)
+QENUM(MP_QSTR_add)
+QENUM(MP_QSTR_all)
+QENUM(MP_QSTR_any)
+QENUM(MP_QSTR_append)
+QENUM(MP_QSTR_args)
+QENUM(MP_QSTR_bin)
+QENUM(MP_QSTR_bool)
+QENUM(MP_QSTR_bound_method)
+QENUM(MP_QSTR_builtins)
+QENUM(MP_QSTR_bytearray)
+QENUM(MP_QSTR_bytecode)
+QENUM(MP_QSTR_byteorder)
+QENUM(MP_QSTR_bytes)
+QENUM(MP_QSTR_calcsize)
+QENUM(MP_QSTR_callable)
+QENUM(MP_QSTR_chr)
+QENUM(MP_QSTR_classmethod)
+QENUM(MP_QSTR_clear)
+QENUM(MP_QSTR_close)
+QENUM(MP_QSTR_closure)
+QENUM(MP_QSTR_complex)
+QENUM(MP_QSTR_const)
+QENUM(MP_QSTR_copy)
+QENUM(MP_QSTR_count)
+QENUM(MP_QSTR_decode)
+QENUM(MP_QSTR_default)
+QENUM(MP_QSTR_delattr)
+QENUM(MP_QSTR_deleter)
+QENUM(MP_QSTR_dict)
+QENUM(MP_QSTR_dict_view)
+QENUM(MP_QSTR_difference)
+QENUM(MP_QSTR_difference_update)
+QENUM(MP_QSTR_dir)
+QENUM(MP_QSTR_discard)
+QENUM(MP_QSTR_divmod)
+QENUM(MP_QSTR_doc)
+QENUM(MP_QSTR_encode)
+QENUM(MP_QSTR_end)
+QENUM(MP_QSTR_endswith)
+QENUM(MP_QSTR_enumerate)
+QENUM(MP_QSTR_errno)
+QENUM(MP_QSTR_eval)
+QENUM(MP_QSTR_exec)
+QENUM(MP_QSTR_extend)
+QENUM(MP_QSTR_filename)
+QENUM(MP_QSTR_filename2)
+QENUM(MP_QSTR_filter)
+QENUM(MP_QSTR_find)
+QENUM(MP_QSTR_float)
+QENUM(MP_QSTR_flush)
+QENUM(MP_QSTR_format)
+QENUM(MP_QSTR_from_bytes)
+QENUM(MP_QSTR_fromkeys)
+QENUM(MP_QSTR_function)
+QENUM(MP_QSTR_generator)
+QENUM(MP_QSTR_get)
+QENUM(MP_QSTR_getattr)
+QENUM(MP_QSTR_getter)
+QENUM(MP_QSTR_globals)
+QENUM(MP_QSTR_hasattr)
+QENUM(MP_QSTR_hash)
+QENUM(MP_QSTR_heap_lock)
+QENUM(MP_QSTR_heap_unlock)
+QENUM(MP_QSTR_hex)
+QENUM(MP_QSTR_id)
+QENUM(MP_QSTR_imag)
+QENUM(MP_QSTR_index)
+QENUM(MP_QSTR_insert)
+QENUM(MP_QSTR_int)
+QENUM(MP_QSTR_intersection)
+QENUM(MP_QSTR_intersection_update)
+QENUM(MP_QSTR_isalpha)
+QENUM(MP_QSTR_isdigit)
+QENUM(MP_QSTR_isdisjoint)
+QENUM(MP_QSTR_isinstance)
+QENUM(MP_QSTR_islower)
+QENUM(MP_QSTR_isspace)
+QENUM(MP_QSTR_issubclass)
+QENUM(MP_QSTR_issubset)
+QENUM(MP_QSTR_issuperset)
+QENUM(MP_QSTR_isupper)
+QENUM(MP_QSTR_items)
+QENUM(MP_QSTR_iter)
+QENUM(MP_QSTR_iterable)
+QENUM(MP_QSTR_iterator)
+QENUM(MP_QSTR_join)
+QENUM(MP_QSTR_key)
+QENUM(MP_QSTR_keys)
+QENUM(MP_QSTR_len)
+QENUM(MP_QSTR_length)
+QENUM(MP_QSTR_list)
+QENUM(MP_QSTR_little)
+QENUM(MP_QSTR_locals)
+QENUM(MP_QSTR_lower)
+QENUM(MP_QSTR_lstrip)
+QENUM(MP_QSTR_map)
+QENUM(MP_QSTR_max)
+QENUM(MP_QSTR_micropython)
+QENUM(MP_QSTR_min)
+QENUM(MP_QSTR_module)
+QENUM(MP_QSTR_native)
+QENUM(MP_QSTR_next)
+QENUM(MP_QSTR_object)
+QENUM(MP_QSTR_oct)
+QENUM(MP_QSTR_opt_level)
+QENUM(MP_QSTR_ord)
+QENUM(MP_QSTR_pack)
+QENUM(MP_QSTR_pack_into)
+QENUM(MP_QSTR_pend_throw)
+QENUM(MP_QSTR_pop)
+QENUM(MP_QSTR_popitem)
+QENUM(MP_QSTR_pow)
+QENUM(MP_QSTR_print)
+QENUM(MP_QSTR_property)
+QENUM(MP_QSTR_protocol_pin)
+QENUM(MP_QSTR_protocol_stream)
+QENUM(MP_QSTR_range)
+QENUM(MP_QSTR_real)
+QENUM(MP_QSTR_remove)
+QENUM(MP_QSTR_replace)
+QENUM(MP_QSTR_repr)
+QENUM(MP_QSTR_reverse)
+QENUM(MP_QSTR_reversed)
+QENUM(MP_QSTR_rfind)
+QENUM(MP_QSTR_rindex)
+QENUM(MP_QSTR_round)
+QENUM(MP_QSTR_rsplit)
+QENUM(MP_QSTR_rstrip)
+QENUM(MP_QSTR_send)
+QENUM(MP_QSTR_sep)
+QENUM(MP_QSTR_set)
+QENUM(MP_QSTR_setattr)
+QENUM(MP_QSTR_setdefault)
+QENUM(MP_QSTR_setter)
+QENUM(MP_QSTR_signed)
+QENUM(MP_QSTR_slice)
+QENUM(MP_QSTR_sort)
+QENUM(MP_QSTR_sorted)
+QENUM(MP_QSTR_split)
+QENUM(MP_QSTR_start)
+QENUM(MP_QSTR_startswith)
+QENUM(MP_QSTR_staticmethod)
+QENUM(MP_QSTR_step)
+QENUM(MP_QSTR_stop)
+QENUM(MP_QSTR_str)
+QENUM(MP_QSTR_strerror)
+QENUM(MP_QSTR_strip)
+QENUM(MP_QSTR_sum)
+QENUM(MP_QSTR_super)
+QENUM(MP_QSTR_symmetric_difference)
+QENUM(MP_QSTR_symmetric_difference_update)
+QENUM(MP_QSTR_throw)
+QENUM(MP_QSTR_to_bytes)
+QENUM(MP_QSTR_tuple)
+QENUM(MP_QSTR_type)
+QENUM(MP_QSTR_union)
+QENUM(MP_QSTR_unpack)
+QENUM(MP_QSTR_unpack_from)
+QENUM(MP_QSTR_update)
+QENUM(MP_QSTR_upper)
+QENUM(MP_QSTR_ustruct)
+QENUM(MP_QSTR_value)
+QENUM(MP_QSTR_values)
+QENUM(MP_QSTR_zip)
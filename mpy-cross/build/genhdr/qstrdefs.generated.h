@@ -0,0 +1,585 @@
+// 32   858 000 0
+// 97 a 446 0010 2
+// 101 e 832 0011 3
+// 105 i 464 0100 4
+// 110 n 566 0101 5
+// 111 o 559 0110 6
+// 114 r 524 0111 7
+// 115 s 435 1000 8
+// 116 t 724 1001 9
+// 95 _ 208 10100 20
+// 99 c 302 10101 21
+// 100 d 270 10110 22
+// 108 l 269 10111 23
+// 112 p 231 11000 24
+// 117 u 256 11001 25
+// 39 \' 122 110100 52
+// 98 b 131 110101 53
+// 102 f 155 110110 54
+// 103 g 149 110111 55
+// 109 m 204 111000 56
+// 37 % 72 1110010 114
+// 69 E 69 1110011 115
+// 104 h 75 1110100 116
+// 118 v 65 1110101 117
+// 119 w 57 1110110 118
+// 120 x 73 1110111 119
+// 121 y 104 1111000 120
+// 78 N 33 11110010 242
+// 106 j 35 11110011 243
+// 107 k 42 11110100 244
+// 113 q 40 11110101 245
+// 40 ( 24 111101100 492
+// 41 ) 24 111101101 493
+// 45 - 23 111101110 494
+// 65 A 14 111101111 495
+// 73 I 18 111110000 496
+// 79 O 19 111110001 497
+// 82 R 13 111110010 498
+// 83 S 17 111110011 499
+// 84 T 13 111110100 500
+// 42 * 9 1111101010 1002
+// 44 , 11 1111101011 1003
+// 47 / 9 1111101100 1004
+// 48 0 8 1111101101 1005
+// 58 : 10 1111101110 1006
+// 60 < 9 1111101111 1007
+// 62 > 9 1111110000 1008
+// 67 C 9 1111110001 1009
+// 68 D 10 1111110010 1010
+// 70 F 6 1111110011 1011
+// 77 M 6 1111110100 1012
+// 80 P 6 1111110101 1013
+// 85 U 9 1111110110 1014
+// 122 z 6 1111110111 1015
+// 35 # 5 11111110000 2032
+// 46 . 3 11111110001 2033
+// 49 1 5 11111110010 2034
+// 50 2 4 11111110011 2035
+// 51 3 3 11111110100 2036
+// 61 = 4 11111110101 2037
+// 66 B 5 11111110110 2038
+// 71 G 4 11111110111 2039
+// 72 H 3 11111111000 2040
+// 76 L 4 11111111001 2041
+// 86 V 3 11111111010 2042
+// 125 } 4 11111111011 2043
+// 10 \n 3 111111111000 4088
+// 13 \r 2 111111111001 4089
+// 34 \" 2 111111111010 4090
+// 75 K 2 111111111011 4091
+// 123 { 2 111111111100 4092
+// 54 6 1 1111111111010 8186
+// 56 8 1 1111111111011 8187
+// 59 ; 1 1111111111100 8188
+// 88 X 1 1111111111101 8189
+// 89 Y 1 1111111111110 8190
+// 90 Z 1 1111111111111 8191
+// length count {3: 1, 4: 8, 5: 6, 6: 5, 7: 7, 8: 4, 9: 9, 10: 14, 11: 12, 12: 5, 13: 6}
+// values [' ', 'a', 'e', 'i', 'n', 'o', 'r', 's', 't', '_', 'c', 'd', 'l', 'p', 'u', "'", 'b', 'f', 'g', 'm', '%', 'E', 'h', 'v', 'w', 'x', 'y', 'N', 'j', 'k', 'q', '(', ')', '-', 'A', 'I', 'O', 'R', 'S', 'T', '*', ',', '/', '0', ':', '<', '>', 'C', 'D', 'F', 'M', 'P', 'U', 'z', '#', '.', '1', '2', '3', '=', 'B', 'G', 'H', 'L', 'V', '}', '\n', '\r', '"', 'K', '{', '6', '8', ';', 'X', 'Y', 'Z'] lengths 14 bytearray(b'\x00\x00\x01\x08\x06\x05\x07\x04\t\x0e\x0c\x05\x06\x00')
+// estimated total memory size 41375
+// [' ', 'a', 'e', 'i', 'n', 'o', 'r', 's', 't', '_', 'c', 'd', 'l', 'p', 'u', "'", 'b', 'f', 'g', 'm', '%', 'E', 'h', 'v', 'w', 'x', 'y', 'N', 'j', 'k', 'q', '(', ')', '-', 'A', 'I', 'O', 'R', 'S', 'T', '*', ',', '/', '0', ':', '<', '>', 'C', 'D', 'F', 'M', 'P', 'U', 'z', '#', '.', '1', '2', '3', '=', 'B', 'G', 'H', 'L', 'V', '}', '\n', '\r', '"', 'K', '{', '6', '8', ';', 'X', 'Y', 'Z'] bytearray(b'\x00\x00\x01\x08\x06\x05\x07\x04\t\x0e\x0c\x05\x06\x00')
+// This file was automatically generated by makeqstrdata.py
+
+QDEF(MP_QSTR_NULL, (const byte*)"\x00\x00\x00" "")
+QDEF(MP_QSTR_, (const byte*)"\x05\x15\x00" "")
+QDEF(MP_QSTR___add__, (const byte*)"\xc4\x82\x07" "__add__")
+QDEF(MP_QSTR___aenter__, (const byte*)"\x4c\x84\x0a" "__aenter__")
+QDEF(MP_QSTR___aexit__, (const byte*)"\xc4\xcf\x09" "__aexit__")
+QDEF(MP_QSTR___aiter__, (const byte*)"\x4e\x2b\x09" "__aiter__")
+QDEF(MP_QSTR___anext__, (const byte*)"\x83\xb4\x09" "__anext__")
+QDEF(MP_QSTR___bool__, (const byte*)"\x2b\x65\x08" "__bool__")
+QDEF(MP_QSTR___build_class__, (const byte*)"\x42\x88\x0f" "__build_class__")
+QDEF(MP_QSTR___bytes__, (const byte*)"\xdc\x81\x09" "__bytes__")
+QDEF(MP_QSTR___call__, (const byte*)"\xa7\xf9\x08" "__call__")
+QDEF(MP_QSTR___class__, (const byte*)"\x2b\xc5\x09" "__class__")
+QDEF(MP_QSTR___contains__, (const byte*)"\xc6\x5f\x0c" "__contains__")
+QDEF(MP_QSTR___delitem__, (const byte*)"\xfd\x35\x0b" "__delitem__")
+QDEF(MP_QSTR___dict__, (const byte*)"\x7f\x54\x08" "__dict__")
+QDEF(MP_QSTR___enter__, (const byte*)"\x6d\xba\x09" "__enter__")
+QDEF(MP_QSTR___eq__, (const byte*)"\x71\x3e\x06" "__eq__")
+QDEF(MP_QSTR___exit__, (const byte*)"\x45\xf8\x08" "__exit__")
+QDEF(MP_QSTR___ge__, (const byte*)"\xa7\x46\x06" "__ge__")
+QDEF(MP_QSTR___getattr__, (const byte*)"\x40\xf8\x0b" "__getattr__")
+QDEF(MP_QSTR___getitem__, (const byte*)"\x26\x39\x0b" "__getitem__")
+QDEF(MP_QSTR___gt__, (const byte*)"\xb6\x82\x06" "__gt__")
+QDEF(MP_QSTR___hash__, (const byte*)"\xf7\xc8\x08" "__hash__")
+QDEF(MP_QSTR___iadd__, (const byte*)"\x6d\x4a\x08" "__iadd__")
+QDEF(MP_QSTR___import__, (const byte*)"\x38\x3e\x0a" "__import__")
+QDEF(MP_QSTR___init__, (const byte*)"\x5f\xa5\x08" "__init__")
+QDEF(MP_QSTR___isub__, (const byte*)"\x08\x78\x08" "__isub__")
+QDEF(MP_QSTR___iter__, (const byte*)"\xcf\x32\x08" "__iter__")
+QDEF(MP_QSTR___le__, (const byte*)"\xcc\x13\x06" "__le__")
+QDEF(MP_QSTR___len__, (const byte*)"\xe2\xb0\x07" "__len__")
+QDEF(MP_QSTR___lt__, (const byte*)"\x5d\x68\x06" "__lt__")
+QDEF(MP_QSTR___main__, (const byte*)"\x8e\x13\x08" "__main__")
+QDEF(MP_QSTR___module__, (const byte*)"\xff\x30\x0a" "__module__")
+QDEF(MP_QSTR___name__, (const byte*)"\xe2\x38\x08" "__name__")
+QDEF(MP_QSTR___new__, (const byte*)"\x79\x15\x07" "__new__")
+QDEF(MP_QSTR___next__, (const byte*)"\x02\x73\x08" "__next__")
+QDEF(MP_QSTR___path__, (const byte*)"\xc8\x23\x08" "__path__")
+QDEF(MP_QSTR___qualname__, (const byte*)"\x6b\x00\x0c" "__qualname__")
+QDEF(MP_QSTR___repl_print__, (const byte*)"\x00\xbb\x0e" "__repl_print__")
+QDEF(MP_QSTR___repr__, (const byte*)"\x10\x0b\x08" "__repr__")
+QDEF(MP_QSTR___reversed__, (const byte*)"\x61\xff\x0c" "__reversed__")
+QDEF(MP_QSTR___setitem__, (const byte*)"\x32\x3e\x0b" "__setitem__")
+QDEF(MP_QSTR___str__, (const byte*)"\xd0\xcd\x07" "__str__")
+QDEF(MP_QSTR___sub__, (const byte*)"\x21\x09\x07" "__sub__")
+QDEF(MP_QSTR___traceback__, (const byte*)"\x4f\xcf\x0d" "__traceback__")
+QDEF(MP_QSTR__star_, (const byte*)"\x8f\xb5\x01" "*")
+QDEF(MP_QSTR__, (const byte*)"\xfa\xb5\x01" "_")
+QDEF(MP_QSTR__slash_, (const byte*)"\x8a\xb5\x01" "/")
+QDEF(MP_QSTR__percent__hash_o, (const byte*)"\x6c\x1a\x03" "%#o")
+QDEF(MP_QSTR__percent__hash_x, (const byte*)"\x7b\x1a\x03" "%#x")
+QDEF(MP_QSTR__brace_open__colon__hash_b_brace_close_, (const byte*)"\x58\x37\x05" "{:#b}")
+QDEF(MP_QSTR__space_, (const byte*)"\x85\xb5\x01" " ")
+QDEF(MP_QSTR__0x0a_, (const byte*)"\xaf\xb5\x01" "\x0a")
+QDEF(MP_QSTR_maximum_space_recursion_space_depth_space_exceeded, (const byte*)"\x73\x1e\x20" "maximum recursion depth exceeded")
+QDEF(MP_QSTR__lt_module_gt_, (const byte*)"\xbd\x94\x08" "<module>")
+QDEF(MP_QSTR__lt_lambda_gt_, (const byte*)"\x80\x8c\x08" "<lambda>")
+QDEF(MP_QSTR__lt_listcomp_gt_, (const byte*)"\xd4\x15\x0a" "<listcomp>")
+QDEF(MP_QSTR__lt_dictcomp_gt_, (const byte*)"\xcc\x8d\x0a" "<dictcomp>")
+QDEF(MP_QSTR__lt_setcomp_gt_, (const byte*)"\x54\x51\x09" "<setcomp>")
+QDEF(MP_QSTR__lt_genexpr_gt_, (const byte*)"\x34\x6a\x09" "<genexpr>")
+QDEF(MP_QSTR__lt_string_gt_, (const byte*)"\x52\x53\x08" "<string>")
+QDEF(MP_QSTR__lt_stdin_gt_, (const byte*)"\xe3\x63\x07" "<stdin>")
+QDEF(MP_QSTR_utf_hyphen_8, (const byte*)"\xb7\x82\x05" "utf-8")
+QDEF(MP_QSTR_ArithmeticError, (const byte*)"\x2d\x8c\x0f" "ArithmeticError")
+QDEF(MP_QSTR_AssertionError, (const byte*)"\x97\x5a\x0e" "AssertionError")
+QDEF(MP_QSTR_AttributeError, (const byte*)"\x21\xde\x0e" "AttributeError")
+QDEF(MP_QSTR_BaseException, (const byte*)"\x07\x92\x0d" "BaseException")
+QDEF(MP_QSTR_EACCES, (const byte*)"\x37\xc2\x06" "EACCES")
+QDEF(MP_QSTR_EADDRINUSE, (const byte*)"\x17\x11\x0a" "EADDRINUSE")
+QDEF(MP_QSTR_EAGAIN, (const byte*)"\x20\xec\x06" "EAGAIN")
+QDEF(MP_QSTR_EALREADY, (const byte*)"\x46\x15\x08" "EALREADY")
+QDEF(MP_QSTR_EBADF, (const byte*)"\x61\xa3\x05" "EBADF")
+QDEF(MP_QSTR_ECONNABORTED, (const byte*)"\x27\xab\x0c" "ECONNABORTED")
+QDEF(MP_QSTR_ECONNREFUSED, (const byte*)"\x3a\x2c\x0c" "ECONNREFUSED")
+QDEF(MP_QSTR_ECONNRESET, (const byte*)"\x19\xfb\x0a" "ECONNRESET")
+QDEF(MP_QSTR_EEXIST, (const byte*)"\x53\xad\x06" "EEXIST")
+QDEF(MP_QSTR_EHOSTUNREACH, (const byte*)"\x86\x25\x0c" "EHOSTUNREACH")
+QDEF(MP_QSTR_EINPROGRESS, (const byte*)"\x9a\xa0\x0b" "EINPROGRESS")
+QDEF(MP_QSTR_EINVAL, (const byte*)"\x5c\xff\x06" "EINVAL")
+QDEF(MP_QSTR_EIO, (const byte*)"\x86\xa6\x03" "EIO")
+QDEF(MP_QSTR_EISDIR, (const byte*)"\xa5\x4f\x06" "EISDIR")
+QDEF(MP_QSTR_ENOBUFS, (const byte*)"\xe3\x87\x07" "ENOBUFS")
+QDEF(MP_QSTR_ENODEV, (const byte*)"\xb6\x67\x06" "ENODEV")
+QDEF(MP_QSTR_ENOENT, (const byte*)"\x5e\x65\x06" "ENOENT")
+QDEF(MP_QSTR_ENOMEM, (const byte*)"\xa4\x85\x06" "ENOMEM")
+QDEF(MP_QSTR_ENOTCONN, (const byte*)"\x79\xd7\x08" "ENOTCONN")
+QDEF(MP_QSTR_EOFError, (const byte*)"\x91\xbf\x08" "EOFError")
+QDEF(MP_QSTR_EOPNOTSUPP, (const byte*)"\xac\x97\x0a" "EOPNOTSUPP")
+QDEF(MP_QSTR_EPERM, (const byte*)"\xea\x7f\x05" "EPERM")
+QDEF(MP_QSTR_ETIMEDOUT, (const byte*)"\xff\xf8\x09" "ETIMEDOUT")
+QDEF(MP_QSTR_Ellipsis, (const byte*)"\xf0\xe0\x08" "Ellipsis")
+QDEF(MP_QSTR_Exception, (const byte*)"\xf2\x29\x09" "Exception")
+QDEF(MP_QSTR_GeneratorExit, (const byte*)"\x16\x62\x0d" "GeneratorExit")
+QDEF(MP_QSTR_ImportError, (const byte*)"\x20\x9c\x0b" "ImportError")
+QDEF(MP_QSTR_IndentationError, (const byte*)"\x5c\x20\x10" "IndentationError")
+QDEF(MP_QSTR_IndexError, (const byte*)"\x83\xad\x0a" "IndexError")
+QDEF(MP_QSTR_KeyError, (const byte*)"\xea\x00\x08" "KeyError")
+QDEF(MP_QSTR_KeyboardInterrupt, (const byte*)"\xaf\xe2\x11" "KeyboardInterrupt")
+QDEF(MP_QSTR_LookupError, (const byte*)"\xff\x69\x0b" "LookupError")
+QDEF(MP_QSTR_MemoryError, (const byte*)"\xdc\x83\x0b" "MemoryError")
+QDEF(MP_QSTR_MpyError, (const byte*)"\x39\x7f\x08" "MpyError")
+QDEF(MP_QSTR_NameError, (const byte*)"\xba\x2d\x09" "NameError")
+QDEF(MP_QSTR_NoneType, (const byte*)"\x17\x68\x08" "NoneType")
+QDEF(MP_QSTR_NotImplementedError, (const byte*)"\xc6\x98\x13" "NotImplementedError")
+QDEF(MP_QSTR_OSError, (const byte*)"\xa1\x65\x07" "OSError")
+QDEF(MP_QSTR_OverflowError, (const byte*)"\x81\xe1\x0d" "OverflowError")
+QDEF(MP_QSTR_ReloadException, (const byte*)"\x03\xc2\x0f" "ReloadException")
+QDEF(MP_QSTR_RuntimeError, (const byte*)"\x61\xf1\x0c" "RuntimeError")
+QDEF(MP_QSTR_StopAsyncIteration, (const byte*)"\xec\xf0\x12" "StopAsyncIteration")
+QDEF(MP_QSTR_StopIteration, (const byte*)"\xea\x1c\x0d" "StopIteration")
+QDEF(MP_QSTR_SyntaxError, (const byte*)"\x94\x8f\x0b" "SyntaxError")
+QDEF(MP_QSTR_SystemExit, (const byte*)"\x20\xff\x0a" "SystemExit")
+QDEF(MP_QSTR_TimeoutError, (const byte*)"\x66\x4b\x0c" "TimeoutError")
+QDEF(MP_QSTR_TypeError, (const byte*)"\x25\x96\x09" "TypeError")
+QDEF(MP_QSTR_UnicodeError, (const byte*)"\x22\xd1\x0c" "UnicodeError")
+QDEF(MP_QSTR_ValueError, (const byte*)"\x96\x87\x0a" "ValueError")
+QDEF(MP_QSTR_ZeroDivisionError, (const byte*)"\xb6\x27\x11" "ZeroDivisionError")
+QDEF(MP_QSTR_abs, (const byte*)"\x95\x32\x03" "abs")
+QDEF(MP_QSTR_add, (const byte*)"\x44\x32\x03" "add")
+QDEF(MP_QSTR_all, (const byte*)"\x44\x33\x03" "all")
+QDEF(MP_QSTR_any, (const byte*)"\x13\x33\x03" "any")
+QDEF(MP_QSTR_append, (const byte*)"\x6b\x97\x06" "append")
+QDEF(MP_QSTR_args, (const byte*)"\xc2\xc6\x04" "args")
+QDEF(MP_QSTR_bin, (const byte*)"\xe0\x48\x03" "bin")
+QDEF(MP_QSTR_bool, (const byte*)"\xeb\x3c\x04" "bool")
+QDEF(MP_QSTR_bound_method, (const byte*)"\x97\xa2\x0c" "bound_method")
+QDEF(MP_QSTR_builtins, (const byte*)"\xf7\x31\x08" "builtins")
+QDEF(MP_QSTR_bytearray, (const byte*)"\x76\xa3\x09" "bytearray")
+QDEF(MP_QSTR_bytecode, (const byte*)"\x22\x7d\x08" "bytecode")
+QDEF(MP_QSTR_byteorder, (const byte*)"\x61\x99\x09" "byteorder")
+QDEF(MP_QSTR_bytes, (const byte*)"\x5c\xb2\x05" "bytes")
+QDEF(MP_QSTR_calcsize, (const byte*)"\x4d\x38\x08" "calcsize")
+QDEF(MP_QSTR_callable, (const byte*)"\x0d\x70\x08" "callable")
+QDEF(MP_QSTR_chr, (const byte*)"\xdc\x4c\x03" "chr")
+QDEF(MP_QSTR_classmethod, (const byte*)"\xb4\x8c\x0b" "classmethod")
+QDEF(MP_QSTR_clear, (const byte*)"\x7c\xa0\x05" "clear")
+QDEF(MP_QSTR_close, (const byte*)"\x33\x67\x05" "close")
+QDEF(MP_QSTR_closure, (const byte*)"\x74\xca\x07" "closure")
+QDEF(MP_QSTR_complex, (const byte*)"\xc5\x9d\x07" "complex")
+QDEF(MP_QSTR_const, (const byte*)"\xc0\xff\x05" "const")
+QDEF(MP_QSTR_copy, (const byte*)"\xe0\xdb\x04" "copy")
+QDEF(MP_QSTR_count, (const byte*)"\xa6\x4d\x05" "count")
+QDEF(MP_QSTR_decode, (const byte*)"\xa9\x59\x06" "decode")
+QDEF(MP_QSTR_default, (const byte*)"\xce\x7d\x07" "default")
+QDEF(MP_QSTR_delattr, (const byte*)"\xdb\xc8\x07" "delattr")
+QDEF(MP_QSTR_deleter, (const byte*)"\x6e\xdb\x07" "deleter")
+QDEF(MP_QSTR_dict, (const byte*)"\x3f\xfc\x04" "dict")
+QDEF(MP_QSTR_dict_view, (const byte*)"\x2d\xa9\x09" "dict_view")
+QDEF(MP_QSTR_difference, (const byte*)"\x72\x24\x0a" "difference")
+QDEF(MP_QSTR_difference_update, (const byte*)"\x9c\xfa\x11" "difference_update")
+QDEF(MP_QSTR_dir, (const byte*)"\xfa\x1e\x03" "dir")
+QDEF(MP_QSTR_discard, (const byte*)"\x0f\x71\x07" "discard")
+QDEF(MP_QSTR_divmod, (const byte*)"\xb8\x04\x06" "divmod")
+QDEF(MP_QSTR_doc, (const byte*)"\x2d\x1f\x03" "doc")
+QDEF(MP_QSTR_encode, (const byte*)"\x43\xca\x06" "encode")
+QDEF(MP_QSTR_end, (const byte*)"\x0a\x23\x03" "end")
+QDEF(MP_QSTR_endswith, (const byte*)"\x1b\xa3\x08" "endswith")
+QDEF(MP_QSTR_enumerate, (const byte*)"\x71\xba\x09" "enumerate")
+QDEF(MP_QSTR_errno, (const byte*)"\xc1\x11\x05" "errno")
+QDEF(MP_QSTR_eval, (const byte*)"\x9b\xa6\x04" "eval")
+QDEF(MP_QSTR_exec, (const byte*)"\x1e\xc0\x04" "exec")
+QDEF(MP_QSTR_extend, (const byte*)"\x63\xe8\x06" "extend")
+QDEF(MP_QSTR_filename, (const byte*)"\xe4\x54\x08" "filename")
+QDEF(MP_QSTR_filename2, (const byte*)"\x56\xf1\x09" "filename2")
+QDEF(MP_QSTR_filter, (const byte*)"\x25\xbe\x06" "filter")
+QDEF(MP_QSTR_find, (const byte*)"\x00\x34\x04" "find")
+QDEF(MP_QSTR_float, (const byte*)"\x35\x44\x05" "float")
+QDEF(MP_QSTR_flush, (const byte*)"\x61\xc1\x05" "flush")
+QDEF(MP_QSTR_format, (const byte*)"\x26\x33\x06" "format")
+QDEF(MP_QSTR_from_bytes, (const byte*)"\x35\x74\x0a" "from_bytes")
+QDEF(MP_QSTR_fromkeys, (const byte*)"\x37\xbd\x08" "fromkeys")
+QDEF(MP_QSTR_function, (const byte*)"\x27\x02\x08" "function")
+QDEF(MP_QSTR_generator, (const byte*)"\x96\xc3\x09" "generator")
+QDEF(MP_QSTR_get, (const byte*)"\x33\x3b\x03" "get")
+QDEF(MP_QSTR_getattr, (const byte*)"\xc0\x17\x07" "getattr")
+QDEF(MP_QSTR_getter, (const byte*)"\x90\xb2\x06" "getter")
+QDEF(MP_QSTR_globals, (const byte*)"\x9d\x49\x07" "globals")
+QDEF(MP_QSTR_hasattr, (const byte*)"\x8c\xb0\x07" "hasattr")
+QDEF(MP_QSTR_hash, (const byte*)"\xb7\x70\x04" "hash")
+QDEF(MP_QSTR_heap_lock, (const byte*)"\xad\x8c\x09" "heap_lock")
+QDEF(MP_QSTR_heap_unlock, (const byte*)"\x56\x2d\x0b" "heap_unlock")
+QDEF(MP_QSTR_hex, (const byte*)"\x70\x50\x03" "hex")
+QDEF(MP_QSTR_id, (const byte*)"\x28\x6f\x02" "id")
+QDEF(MP_QSTR_imag, (const byte*)"\x47\xb7\x04" "imag")
+QDEF(MP_QSTR_index, (const byte*)"\x7b\x28\x05" "index")
+QDEF(MP_QSTR_insert, (const byte*)"\x12\x54\x06" "insert")
+QDEF(MP_QSTR_int, (const byte*)"\x16\x53\x03" "int")
+QDEF(MP_QSTR_intersection, (const byte*)"\x28\x2a\x0c" "intersection")
+QDEF(MP_QSTR_intersection_update, (const byte*)"\x06\xdd\x13" "intersection_update")
+QDEF(MP_QSTR_isalpha, (const byte*)"\xeb\x37\x07" "isalpha")
+QDEF(MP_QSTR_isdigit, (const byte*)"\xa8\x9a\x07" "isdigit")
+QDEF(MP_QSTR_isdisjoint, (const byte*)"\xf7\x68\x0a" "isdisjoint")
+QDEF(MP_QSTR_isinstance, (const byte*)"\xb6\xbe\x0a" "isinstance")
+QDEF(MP_QSTR_islower, (const byte*)"\xfc\x80\x07" "islower")
+QDEF(MP_QSTR_isspace, (const byte*)"\x5b\xf8\x07" "isspace")
+QDEF(MP_QSTR_issubclass, (const byte*)"\xb5\x7f\x0a" "issubclass")
+QDEF(MP_QSTR_issubset, (const byte*)"\xb9\xc1\x08" "issubset")
+QDEF(MP_QSTR_issuperset, (const byte*)"\xfc\xec\x0a" "issuperset")
+QDEF(MP_QSTR_isupper, (const byte*)"\xdd\xa7\x07" "isupper")
+QDEF(MP_QSTR_items, (const byte*)"\xe3\x53\x05" "items")
+QDEF(MP_QSTR_iter, (const byte*)"\x8f\x21\x04" "iter")
+QDEF(MP_QSTR_iterable, (const byte*)"\x25\x92\x08" "iterable")
+QDEF(MP_QSTR_iterator, (const byte*)"\x47\xbe\x08" "iterator")
+QDEF(MP_QSTR_join, (const byte*)"\xa7\x5c\x04" "join")
+QDEF(MP_QSTR_key, (const byte*)"\x32\x6d\x03" "key")
+QDEF(MP_QSTR_keys, (const byte*)"\x01\x13\x04" "keys")
+QDEF(MP_QSTR_len, (const byte*)"\x62\x40\x03" "len")
+QDEF(MP_QSTR_length, (const byte*)"\x59\x87\x06" "length")
+QDEF(MP_QSTR_list, (const byte*)"\x27\x1d\x04" "list")
+QDEF(MP_QSTR_little, (const byte*)"\x89\x6a\x06" "little")
+QDEF(MP_QSTR_locals, (const byte*)"\x3b\xa1\x06" "locals")
+QDEF(MP_QSTR_lower, (const byte*)"\xc6\xcb\x05" "lower")
+QDEF(MP_QSTR_lstrip, (const byte*)"\xe5\xb9\x06" "lstrip")
+QDEF(MP_QSTR_map, (const byte*)"\xb9\x43\x03" "map")
+QDEF(MP_QSTR_max, (const byte*)"\xb1\x43\x03" "max")
+QDEF(MP_QSTR_micropython, (const byte*)"\x0b\x7c\x0b" "micropython")
+QDEF(MP_QSTR_min, (const byte*)"\xaf\x42\x03" "min")
+QDEF(MP_QSTR_module, (const byte*)"\xbf\x99\x06" "module")
+QDEF(MP_QSTR_native, (const byte*)"\x84\x0b\x06" "native")
+QDEF(MP_QSTR_next, (const byte*)"\x42\x88\x04" "next")
+QDEF(MP_QSTR_object, (const byte*)"\x90\x8d\x06" "object")
+QDEF(MP_QSTR_oct, (const byte*)"\xfd\x5c\x03" "oct")
+QDEF(MP_QSTR_opt_level, (const byte*)"\x87\x67\x09" "opt_level")
+QDEF(MP_QSTR_ord, (const byte*)"\x1c\x5e\x03" "ord")
+QDEF(MP_QSTR_pack, (const byte*)"\xbc\xd1\x04" "pack")
+QDEF(MP_QSTR_pack_into, (const byte*)"\x1f\xa9\x09" "pack_into")
+QDEF(MP_QSTR_pend_throw, (const byte*)"\xf3\x74\x0a" "pend_throw")
+QDEF(MP_QSTR_pop, (const byte*)"\x2a\x73\x03" "pop")
+QDEF(MP_QSTR_popitem, (const byte*)"\xbf\x2c\x07" "popitem")
+QDEF(MP_QSTR_pow, (const byte*)"\x2d\x73\x03" "pow")
+QDEF(MP_QSTR_print, (const byte*)"\x54\xc6\x05" "print")
+QDEF(MP_QSTR_property, (const byte*)"\xc2\x29\x08" "property")
+QDEF(MP_QSTR_protocol_pin, (const byte*)"\x1b\x57\x0c" "protocol_pin")
+QDEF(MP_QSTR_protocol_stream, (const byte*)"\x90\x24\x0f" "protocol_stream")
+QDEF(MP_QSTR_range, (const byte*)"\x1a\x5e\x05" "range")
+QDEF(MP_QSTR_real, (const byte*)"\xbf\xf9\x04" "real")
+QDEF(MP_QSTR_remove, (const byte*)"\x63\x8a\x06" "remove")
+QDEF(MP_QSTR_replace, (const byte*)"\x49\x25\x07" "replace")
+QDEF(MP_QSTR_repr, (const byte*)"\xd0\xf7\x04" "repr")
+QDEF(MP_QSTR_reverse, (const byte*)"\x25\x2a\x07" "reverse")
+QDEF(MP_QSTR_reversed, (const byte*)"\xa1\x6e\x08" "reversed")
+QDEF(MP_QSTR_rfind, (const byte*)"\xd2\x9c\x05" "rfind")
+QDEF(MP_QSTR_rindex, (const byte*)"\xe9\x2b\x06" "rindex")
+QDEF(MP_QSTR_round, (const byte*)"\xe7\x25\x05" "round")
+QDEF(MP_QSTR_rsplit, (const byte*)"\xa5\x00\x06" "rsplit")
+QDEF(MP_QSTR_rstrip, (const byte*)"\x3b\x95\x06" "rstrip")
+QDEF(MP_QSTR_send, (const byte*)"\xb9\x76\x04" "send")
+QDEF(MP_QSTR_sep, (const byte*)"\x23\x8f\x03" "sep")
+QDEF(MP_QSTR_set, (const byte*)"\x27\x8f\x03" "set")
+QDEF(MP_QSTR_setattr, (const byte*)"\xd4\xa8\x07" "setattr")
+QDEF(MP_QSTR_setdefault, (const byte*)"\x6c\xa3\x0a" "setdefault")
+QDEF(MP_QSTR_setter, (const byte*)"\x04\x59\x06" "setter")
+QDEF(MP_QSTR_signed, (const byte*)"\x37\x01\x06" "signed")
+QDEF(MP_QSTR_slice, (const byte*)"\xb5\xf4\x05" "slice")
+QDEF(MP_QSTR_sort, (const byte*)"\xbf\x9d\x04" "sort")
+QDEF(MP_QSTR_sorted, (const byte*)"\x5e\x15\x06" "sorted")
+QDEF(MP_QSTR_split, (const byte*)"\xb7\x33\x05" "split")
+QDEF(MP_QSTR_start, (const byte*)"\x85\xef\x05" "start")
+QDEF(MP_QSTR_startswith, (const byte*)"\x74\xe8\x0a" "startswith")
+QDEF(MP_QSTR_staticmethod, (const byte*)"\x62\xaf\x0c" "staticmethod")
+QDEF(MP_QSTR_step, (const byte*)"\x57\x36\x04" "step")
+QDEF(MP_QSTR_stop, (const byte*)"\x9d\x36\x04" "stop")
+QDEF(MP_QSTR_str, (const byte*)"\x50\x8d\x03" "str")
+QDEF(MP_QSTR_strerror, (const byte*)"\x48\x71\x08" "strerror")
+QDEF(MP_QSTR_strip, (const byte*)"\x29\x1e\x05" "strip")
+QDEF(MP_QSTR_sum, (const byte*)"\x2e\x8d\x03" "sum")
+QDEF(MP_QSTR_super, (const byte*)"\xc4\xb2\x05" "super")
+QDEF(MP_QSTR_symmetric_difference, (const byte*)"\xce\x67\x14" "symmetric_difference")
+QDEF(MP_QSTR_symmetric_difference_update, (const byte*)"\x60\xf8\x1b" "symmetric_difference_update")
+QDEF(MP_QSTR_throw, (const byte*)"\xb3\x44\x05" "throw")
+QDEF(MP_QSTR_to_bytes, (const byte*)"\xd8\x3e\x08" "to_bytes")
+QDEF(MP_QSTR_tuple, (const byte*)"\xfd\x41\x05" "tuple")
+QDEF(MP_QSTR_type, (const byte*)"\x9d\x7f\x04" "type")
+QDEF(MP_QSTR_union, (const byte*)"\xf6\x7c\x05" "union")
+QDEF(MP_QSTR_unpack, (const byte*)"\x07\x3c\x06" "unpack")
+QDEF(MP_QSTR_unpack_from, (const byte*)"\x0e\x6d\x0b" "unpack_from")
+QDEF(MP_QSTR_update, (const byte*)"\xb4\x76\x06" "update")
+QDEF(MP_QSTR_upper, (const byte*)"\x27\x94\x05" "upper")
+QDEF(MP_QSTR_ustruct, (const byte*)"\x47\x08\x07" "ustruct")
+QDEF(MP_QSTR_value, (const byte*)"\x4e\x34\x05" "value")
+QDEF(MP_QSTR_values, (const byte*)"\x7d\xbe\x06" "values")
+QDEF(MP_QSTR_zip, (const byte*)"\xe6\xac\x03" "zip")
+TRANSLATION("  File \"%q\", line %d", 40, 7, 230, 151, 49, 255, 92, 189, 127, 235, 235, 23, 69, 49, 202, 192) //   File \"%q\", line %d
+TRANSLATION("%%c requires int or char", 49, 203, 149, 67, 159, 174, 81, 206, 2, 44, 134, 113, 94, 132, 224) // %%c requires int or char
+TRANSLATION("%q index out of range", 43, 203, 212, 34, 216, 251, 134, 204, 134, 216, 57, 46, 230) // %q index out of range
+TRANSLATION("%q indices must be integers, not %s", 71, 203, 212, 34, 217, 42, 112, 56, 204, 72, 212, 194, 44, 158, 230, 241, 245, 133, 105, 28, 160) // %q indices must be integers, not %s
+TRANSLATION("%q() takes %d positional arguments but %d were given", 105, 203, 215, 217, 237, 18, 94, 135, 3, 149, 134, 26, 18, 81, 148, 174, 9, 247, 207, 6, 179, 3, 92, 200, 229, 97, 216, 220, 198, 233, 212, 212) // %q() takes %d positional arguments but %d were given
+TRANSLATION("'%q' argument required", 45, 167, 47, 93, 1, 62, 249, 224, 214, 67, 159, 174, 81, 206, 192) // \'%q\' argument required
+TRANSLATION("'%s' object cannot assign attribute '%q'", 81, 167, 40, 208, 54, 190, 103, 89, 21, 37, 86, 144, 81, 9, 186, 130, 153, 116, 215, 50, 99, 78, 94, 186, 0) // \'%s\' object cannot assign attribute \'%q\'
+TRANSLATION("'%s' object does not support '%q'", 67, 167, 40, 208, 54, 190, 103, 89, 22, 99, 128, 173, 34, 51, 140, 51, 200, 211, 151, 174, 128) // \'%s\' object does not support \'%q\'
+TRANSLATION("'%s' object does not support item assignment", 89, 167, 40, 208, 54, 190, 103, 89, 22, 99, 128, 173, 34, 51, 140, 51, 200, 73, 62, 1, 68, 38, 235, 193, 172, 128) // \'%s\' object does not support item assignment
+TRANSLATION("'%s' object does not support item deletion", 85, 167, 40, 208, 54, 190, 103, 89, 22, 99, 128, 173, 34, 51, 140, 51, 200, 73, 62, 5, 142, 231, 40, 202) // \'%s\' object does not support item deletion
+TRANSLATION("'%s' object has no attribute '%q'", 67, 167, 40, 208, 54, 190, 103, 89, 29, 10, 2, 176, 41, 151, 77, 115, 38, 52, 229, 235, 160) // \'%s\' object has no attribute \'%q\'
+TRANSLATION("'%s' object is not an iterator", 61, 167, 40, 208, 54, 190, 103, 89, 9, 1, 90, 65, 40, 73, 55, 41, 103) // \'%s\' object is not an iterator
+TRANSLATION("'%s' object is not callable", 55, 167, 40, 208, 54, 190, 103, 89, 9, 1, 90, 69, 74, 247, 45, 110, 96) // \'%s\' object is not callable
+TRANSLATION("'%s' object is not iterable", 55, 167, 40, 208, 54, 190, 103, 89, 9, 1, 90, 66, 73, 185, 107, 115) // \'%s\' object is not iterable
+TRANSLATION("'%s' object is not subscriptable", 65, 167, 40, 208, 54, 190, 103, 89, 9, 1, 90, 68, 103, 88, 171, 166, 36, 181, 185, 128) // \'%s\' object is not subscriptable
+TRANSLATION("'=' alignment not allowed in string format specifier", 105, 167, 245, 208, 21, 211, 117, 224, 214, 66, 180, 130, 189, 219, 177, 216, 34, 136, 151, 69, 220, 108, 207, 193, 72, 140, 29, 83, 100, 55) // \'=\' alignment not allowed in string format specifier
+TRANSLATION("'async for' or 'async with' outside async function", 101, 161, 71, 133, 168, 217, 159, 64, 206, 52, 40, 240, 181, 29, 146, 122, 104, 27, 51, 9, 99, 5, 30, 22, 163, 108, 173, 101, 25, 64) // \'async for\' or \'async with\' outside async function
+TRANSLATION("'await' outside function", 49, 161, 118, 36, 157, 3, 102, 97, 44, 99, 108, 173, 101, 25, 64) // \'await\' outside function
+TRANSLATION("'break' outside loop", 41, 166, 174, 101, 233, 160, 108, 204, 37, 140, 93, 155, 0) // \'break\' outside loop
+TRANSLATION("'continue' outside loop", 47, 165, 89, 101, 23, 39, 160, 108, 204, 37, 140, 93, 155, 0) // \'continue\' outside loop
+TRANSLATION("'return' outside function", 51, 163, 156, 229, 215, 64, 217, 152, 75, 24, 219, 43, 89, 70, 80) // \'return\' outside function
+TRANSLATION("'yield' outside function", 49, 167, 132, 59, 219, 64, 217, 152, 75, 24, 219, 43, 89, 70, 80) // \'yield\' outside function
+TRANSLATION("*x must be assignment target", 57, 245, 119, 28, 102, 36, 106, 96, 162, 19, 117, 224, 214, 68, 147, 238, 114) // *x must be assignment target
+TRANSLATION(", in %q\n", 19, 245, 132, 81, 203, 215, 254, 127, 224) // , in %q\r\n
+TRANSLATION("0.0 to a complex power", 45, 246, 255, 31, 180, 75, 2, 21, 110, 49, 115, 238, 48, 221, 141, 192) // 0.0 to a complex power
+TRANSLATION("3-arg pow() not supported", 51, 253, 61, 196, 251, 140, 55, 111, 103, 180, 43, 72, 140, 227, 12, 242, 118) // 3-arg pow() not supported
+TRANSLATION("Call super().__init__() before accessing native object.", 111, 248, 149, 238, 35, 56, 55, 246, 123, 127, 141, 40, 138, 147, 74, 123, 61, 163, 83, 217, 156, 193, 86, 167, 16, 139, 184, 82, 148, 234, 97, 181, 243, 58, 207, 241) // Call super().__init__() before accessing native object.
+TRANSLATION("Corrupt raw code", 33, 248, 179, 190, 113, 33, 203, 176, 171, 88, 192) // Corrupt raw code
+TRANSLATION("File exists", 23, 249, 165, 204, 31, 116, 137, 128) // File exists
+TRANSLATION("Input/output error", 37, 240, 92, 102, 126, 198, 204, 227, 50, 13, 221, 156) // Input/output error
+TRANSLATION("Invalid argument", 33, 240, 94, 165, 116, 176, 39, 223, 60, 26, 200) // Invalid argument
+TRANSLATION("LHS of keyword arg must be an id", 65, 254, 127, 199, 204, 54, 195, 208, 252, 118, 103, 176, 39, 220, 113, 152, 145, 169, 130, 80, 150) // LHS of keyword arg must be an id
+TRANSLATION("Name too long", 27, 228, 92, 24, 150, 97, 118, 93, 192) // Name too long
+TRANSLATION("No space left on device", 47, 228, 194, 48, 85, 49, 115, 218, 67, 40, 177, 245, 74, 152) // No space left on device
+TRANSLATION("No such file/directory", 45, 228, 194, 51, 94, 131, 100, 185, 253, 150, 71, 58, 203, 63, 128) // No such file/directory
+TRANSLATION("Permission denied", 35, 250, 155, 240, 145, 8, 202, 44, 106, 135, 96) // Permission denied
+TRANSLATION("Read-only filesystem", 41, 242, 50, 183, 185, 150, 254, 6, 201, 115, 143, 17, 39, 192) // Read-only filesystem
+TRANSLATION("Traceback (most recent call last):\n", 73, 244, 114, 169, 234, 85, 244, 30, 206, 26, 36, 57, 212, 214, 69, 74, 247, 23, 40, 159, 111, 221, 255, 63, 240) // Traceback (most recent call last):\r\n
+TRANSLATION("Unable to init parser", 43, 251, 41, 107, 115, 18, 193, 21, 36, 96, 158, 13, 192) // Unable to init parser
+TRANSLATION("Unsupported operation", 43, 251, 44, 103, 24, 103, 147, 176, 108, 27, 148, 163, 40) // Unsupported operation
+TRANSLATION("__init__() should return None", 59, 74, 34, 164, 210, 158, 207, 104, 142, 141, 155, 216, 57, 206, 93, 71, 147, 41, 128) // __init__() should return None
+TRANSLATION("__init__() should return None, not '%s'", 79, 74, 34, 164, 210, 158, 207, 104, 142, 141, 155, 216, 57, 206, 93, 71, 147, 41, 253, 97, 90, 70, 156, 163, 64) // __init__() should return None, not \'%s\'
+TRANSLATION("__new__ arg must be a user-type", 63, 74, 41, 246, 165, 1, 62, 227, 140, 196, 141, 76, 16, 204, 27, 251, 167, 198, 12) // __new__ arg must be a user-type
+TRANSLATION("a bytes-like object is required", 62, 67, 95, 18, 113, 238, 186, 122, 24, 109, 124, 206, 178, 18, 3, 159, 174, 81, 206, 192) // a bytes-like object is required
+TRANSLATION("abort() called", 28, 90, 179, 207, 179, 218, 42, 87, 185, 216) // abort() called
+TRANSLATION("arg is an empty sequence", 48, 79, 184, 72, 4, 160, 248, 196, 248, 16, 126, 185, 53, 169, 128) // arg is an empty sequence
+TRANSLATION("argument has wrong type", 46, 79, 190, 120, 53, 145, 208, 160, 118, 118, 93, 196, 248, 193, 128) // argument has wrong type
+TRANSLATION("argument num/types mismatch", 54, 79, 190, 120, 53, 144, 185, 227, 236, 159, 24, 56, 28, 36, 112, 83, 94, 128) // argument num/types mismatch
+TRANSLATION("argument should be a '%q' not a '%q'", 72, 79, 190, 120, 53, 145, 29, 27, 55, 176, 212, 193, 13, 57, 122, 232, 21, 164, 16, 211, 151, 174, 128) // argument should be a \'%q\' not a \'%q\'
+TRANSLATION("attributes not supported yet", 56, 83, 46, 154, 230, 78, 2, 180, 136, 206, 48, 207, 39, 97, 224, 228) // attributes not supported yet
+TRANSLATION("bad conversion specifier", 49, 169, 88, 85, 151, 169, 188, 35, 40, 140, 29, 83, 100, 55) // bad conversion specifier
+TRANSLATION("bad typecode", 25, 169, 88, 79, 140, 29, 90, 198) // bad typecode
+TRANSLATION("buffer too small", 33, 174, 118, 216, 220, 75, 48, 142, 10, 247) // buffer too small
+TRANSLATION("byte code not implemented", 51, 175, 137, 49, 86, 177, 133, 105, 9, 198, 46, 124, 26, 201, 216) // byte code not implemented
+TRANSLATION("bytes value out of range", 49, 175, 137, 56, 29, 74, 249, 48, 217, 144, 219, 7, 37, 220, 192) // bytes value out of range
+TRANSLATION("can only save bytecode", 45, 82, 80, 203, 127, 2, 11, 169, 141, 124, 73, 213, 172, 96) // can only save bytecode
+TRANSLATION("can't add special method to already-subclassed class", 105, 82, 93, 36, 21, 172, 35, 7, 84, 43, 142, 14, 122, 53, 132, 176, 43, 185, 149, 188, 123, 163, 58, 214, 229, 16, 118, 21, 185, 68, 0) // can\'t add special method to already-subclassed class
+TRANSLATION("can't assign to expression", 53, 82, 93, 36, 20, 66, 110, 162, 88, 31, 124, 57, 196, 35, 40) // can\'t assign to expression
+TRANSLATION("can't convert %s to complex", 55, 82, 93, 36, 85, 151, 169, 188, 142, 80, 37, 133, 91, 140, 92, 251, 128) // can\'t convert %s to complex
+TRANSLATION("can't convert %s to float", 51, 82, 93, 36, 85, 151, 169, 188, 142, 80, 37, 134, 215, 98, 144) // can\'t convert %s to float
+TRANSLATION("can't convert %s to int", 47, 82, 93, 36, 85, 151, 169, 188, 142, 80, 37, 130, 44, 128) // can\'t convert %s to int
+TRANSLATION("can't convert '%q' object to %q implicitly", 85, 82, 93, 36, 85, 151, 169, 188, 141, 57, 122, 232, 27, 95, 51, 172, 137, 97, 203, 212, 39, 24, 186, 85, 38, 254, 0) // can\'t convert \'%q\' object to %q implicitly
+TRANSLATION("can't convert NaN to int", 49, 82, 93, 36, 85, 151, 169, 188, 143, 34, 242, 18, 193, 22, 64) // can\'t convert NaN to int
+TRANSLATION("can't convert inf to int", 49, 82, 93, 36, 85, 151, 169, 188, 132, 93, 132, 176, 69, 144) // can\'t convert inf to int
+TRANSLATION("can't convert to complex", 49, 82, 93, 36, 85, 151, 169, 188, 137, 97, 86, 227, 23, 62, 224) // can\'t convert to complex
+TRANSLATION("can't convert to float", 45, 82, 93, 36, 85, 151, 169, 188, 137, 97, 181, 216, 164) // can\'t convert to float
+TRANSLATION("can't convert to int", 41, 82, 93, 36, 85, 151, 169, 188, 137, 96, 139, 32) // can\'t convert to int
+TRANSLATION("can't convert to str implicitly", 63, 82, 93, 36, 85, 151, 169, 188, 137, 97, 18, 225, 56, 197, 210, 169, 55, 240) // can\'t convert to str implicitly
+TRANSLATION("can't declare nonlocal in outer code", 73, 82, 93, 36, 88, 235, 114, 115, 10, 203, 118, 169, 92, 34, 134, 204, 155, 138, 181, 140) // can\'t declare nonlocal in outer code
+TRANSLATION("can't delete expression", 47, 82, 93, 36, 88, 238, 114, 96, 251, 225, 206, 33, 25, 64) // can\'t delete expression
+TRANSLATION("can't do truncated division of a complex number", 95, 82, 93, 36, 89, 132, 190, 86, 165, 39, 97, 100, 234, 144, 140, 161, 182, 4, 42, 220, 98, 231, 220, 46, 120, 212, 220) // can\'t do truncated division of a complex number
+TRANSLATION("can't have multiple **x", 47, 82, 93, 36, 116, 46, 166, 56, 205, 229, 49, 115, 31, 87, 213, 220) // can\'t have multiple **x
+TRANSLATION("can't have multiple *x", 45, 82, 93, 36, 116, 46, 166, 56, 205, 229, 49, 115, 31, 87, 112) // can\'t have multiple *x
+TRANSLATION("can't pend throw to just-started generator", 85, 82, 93, 36, 96, 214, 194, 122, 59, 118, 18, 195, 207, 49, 62, 232, 146, 121, 59, 13, 205, 77, 202, 89, 192) // can\'t pend throw to just-started generator
+TRANSLATION("can't send non-None value to a just-started generator", 107, 82, 93, 36, 65, 173, 130, 178, 251, 188, 153, 76, 117, 43, 228, 196, 176, 33, 231, 152, 159, 116, 73, 60, 157, 134, 230, 166, 229, 44, 224) // can\'t send non-None value to a just-started generator
+TRANSLATION("can't switch from automatic field numbering to manual field specification", 147, 82, 93, 36, 71, 100, 154, 244, 27, 59, 112, 11, 50, 220, 20, 165, 70, 200, 119, 176, 92, 241, 169, 186, 46, 226, 88, 112, 75, 146, 184, 217, 14, 246, 17, 131, 170, 108, 149, 41, 70, 80) // can\'t switch from automatic field numbering to manual field specification
+TRANSLATION("can't switch from manual field specification to automatic field numbering", 147, 82, 93, 36, 71, 100, 154, 244, 27, 59, 112, 56, 37, 201, 92, 108, 135, 123, 8, 193, 213, 54, 74, 148, 163, 40, 150, 5, 153, 110, 10, 82, 163, 100, 59, 216, 46, 120, 212, 221, 23, 112) // can\'t switch from manual field specification to automatic field numbering
+TRANSLATION("cannot create '%q' instances", 57, 82, 85, 105, 21, 115, 41, 49, 167, 47, 93, 2, 44, 73, 45, 78, 0) // cannot create \'%q\' instances
+TRANSLATION("cannot create instance", 45, 82, 85, 105, 21, 115, 41, 48, 139, 18, 75, 83) // cannot create instance
+TRANSLATION("cannot import name %q", 43, 82, 85, 105, 9, 198, 25, 228, 41, 112, 99, 151, 168) // cannot import name %q
+TRANSLATION("cannot perform relative import", 61, 82, 85, 105, 24, 55, 217, 159, 128, 231, 114, 148, 234, 97, 56, 195, 60, 128) // cannot perform relative import
+TRANSLATION("chr() arg not in range(0x110000)", 65, 94, 143, 236, 246, 130, 125, 194, 180, 132, 80, 228, 187, 159, 179, 237, 239, 252, 191, 151, 219, 246, 253, 191, 111, 180) // chr() arg not in range(0x110000)
+TRANSLATION("complex division by zero", 49, 86, 227, 23, 62, 226, 201, 213, 33, 25, 70, 190, 7, 238, 110, 192) // complex division by zero
+TRANSLATION("constant must be an integer", 55, 86, 88, 146, 89, 28, 102, 36, 106, 96, 148, 34, 201, 238, 110) // constant must be an integer
+TRANSLATION("default 'except' must be last", 59, 99, 216, 179, 121, 26, 31, 122, 158, 39, 65, 198, 98, 70, 166, 46, 81, 32) // default \'except\' must be last
+TRANSLATION("dict update sequence has wrong length", 75, 100, 172, 140, 226, 197, 38, 32, 253, 114, 107, 83, 29, 10, 7, 103, 101, 220, 92, 215, 121, 232) // dict update sequence has wrong length
+TRANSLATION("division by zero", 33, 100, 234, 144, 140, 163, 95, 3, 247, 55, 96) // division by zero
+TRANSLATION("empty separator", 30, 124, 98, 124, 8, 60, 19, 148, 179, 128) // empty separator
+TRANSLATION("end of format while looking for conversion specifier", 104, 107, 96, 219, 13, 153, 248, 41, 29, 186, 37, 204, 93, 155, 209, 23, 113, 179, 56, 171, 47, 83, 120, 70, 81, 24, 58, 166, 200, 110) // end of format while looking for conversion specifier
+TRANSLATION("exceptions must derive from BaseException", 82, 125, 234, 120, 148, 101, 129, 198, 98, 69, 141, 211, 169, 141, 157, 184, 31, 216, 160, 249, 247, 169, 226, 81, 148) // exceptions must derive from BaseException
+TRANSLATION("expected ':' after format specifier", 70, 125, 240, 117, 147, 176, 211, 238, 208, 22, 210, 110, 54, 103, 224, 164, 70, 14, 169, 178, 27, 128) // expected \':\' after format specifier
+TRANSLATION("expected tuple/list", 38, 125, 240, 117, 147, 176, 156, 226, 231, 246, 93, 34, 64) // expected tuple/list
+TRANSLATION("expecting just a value for set", 60, 125, 240, 117, 148, 93, 199, 158, 98, 65, 14, 165, 124, 152, 217, 156, 65, 200) // expecting just a value for set
+TRANSLATION("expecting key:value for dict", 56, 125, 240, 117, 148, 93, 199, 161, 248, 251, 186, 149, 242, 99, 102, 113, 100, 172, 128) // expecting key:value for dict
+TRANSLATION("extra keyword arguments given", 58, 125, 229, 200, 122, 31, 142, 204, 246, 4, 251, 231, 131, 89, 129, 186, 117, 53) // extra keyword arguments given
+TRANSLATION("extra positional arguments given", 64, 125, 229, 200, 97, 161, 37, 25, 74, 224, 159, 124, 240, 107, 48, 55, 78, 166, 160) // extra positional arguments given
+TRANSLATION("f-string expression part cannot include a '#'", 91, 183, 186, 37, 209, 119, 7, 223, 14, 113, 8, 202, 48, 79, 34, 164, 170, 210, 17, 107, 124, 216, 193, 13, 63, 134, 128) // f-string expression part cannot include a \'#\'
+TRANSLATION("f-string expression part cannot include a backslash", 103, 183, 186, 37, 209, 119, 7, 223, 14, 113, 8, 202, 48, 79, 34, 164, 170, 210, 17, 107, 124, 216, 193, 13, 74, 190, 145, 114, 142, 128) // f-string expression part cannot include a backslash
+TRANSLATION("f-string: empty expression not allowed", 77, 183, 186, 37, 209, 119, 251, 129, 241, 137, 240, 15, 190, 28, 226, 17, 148, 43, 72, 43, 221, 187, 29, 128) // f-string: empty expression not allowed
+TRANSLATION("f-string: expecting '}'", 47, 183, 186, 37, 209, 119, 251, 129, 247, 193, 214, 81, 119, 26, 127, 189, 0) // f-string: expecting \'}\'
+TRANSLATION("f-string: single '}' is not allowed", 71, 183, 186, 37, 209, 119, 251, 132, 34, 239, 115, 26, 127, 189, 2, 64, 86, 144, 87, 187, 118, 59, 0) // f-string: single \'}\' is not allowed
+TRANSLATION("first argument to super() must be type", 77, 178, 60, 72, 39, 223, 60, 26, 200, 150, 17, 156, 27, 251, 61, 163, 140, 196, 141, 76, 79, 140, 24) // first argument to super() must be type
+TRANSLATION("format requires a dict", 45, 179, 63, 5, 33, 207, 215, 40, 231, 0, 133, 146, 178) // format requires a dict
+TRANSLATION("function does not take keyword arguments", 81, 182, 86, 178, 140, 162, 204, 112, 21, 164, 73, 122, 24, 244, 63, 29, 153, 236, 9, 247, 207, 6, 179, 0) // function does not take keyword arguments
+TRANSLATION("function expected at most %d arguments, got %d", 93, 182, 86, 178, 140, 160, 251, 224, 235, 39, 96, 82, 56, 104, 145, 202, 192, 159, 124, 240, 107, 49, 245, 141, 218, 71, 43, 0) // function expected at most %d arguments, got %d
+TRANSLATION("function got multiple values for argument '%q'", 93, 182, 86, 178, 140, 163, 118, 145, 198, 111, 41, 139, 152, 234, 87, 201, 192, 217, 156, 19, 239, 158, 13, 100, 105, 203, 215, 64) // function got multiple values for argument \'%q\'
+TRANSLATION("function missing %d required positional arguments", 99, 182, 86, 178, 140, 163, 132, 136, 69, 220, 114, 176, 115, 245, 202, 57, 216, 97, 161, 37, 25, 74, 224, 159, 124, 240, 107, 48) // function missing %d required positional arguments
+TRANSLATION("function missing keyword-only argument", 77, 182, 86, 178, 140, 163, 132, 136, 69, 220, 122, 31, 142, 204, 246, 247, 50, 223, 192, 39, 223, 60, 26, 200) // function missing keyword-only argument
+TRANSLATION("function missing required keyword argument '%q'", 95, 182, 86, 178, 140, 163, 132, 136, 69, 220, 57, 250, 229, 28, 236, 61, 15, 199, 102, 123, 2, 125, 243, 193, 172, 141, 57, 122, 232) // function missing required keyword argument \'%q\'
+TRANSLATION("function missing required positional argument #%d", 99, 182, 86, 178, 140, 163, 132, 136, 69, 220, 57, 250, 229, 28, 236, 48, 208, 146, 140, 165, 112, 79, 190, 120, 53, 145, 252, 57, 88) // function missing required positional argument #%d
+TRANSLATION("function takes %d positional arguments but %d were given", 113, 182, 86, 178, 140, 162, 75, 208, 224, 114, 176, 195, 66, 74, 50, 149, 193, 62, 249, 224, 214, 96, 107, 153, 28, 172, 59, 27, 152, 221, 58, 154, 128) // function takes %d positional arguments but %d were given
+TRANSLATION("generator already executing", 55, 185, 169, 185, 75, 56, 43, 185, 149, 188, 3, 238, 117, 204, 162, 238) // generator already executing
+TRANSLATION("generator ignored GeneratorExit", 63, 185, 169, 185, 75, 56, 77, 213, 156, 236, 63, 185, 169, 185, 75, 63, 62, 233, 32) // generator ignored GeneratorExit
+TRANSLATION("identifier redefined as global", 60, 150, 53, 148, 217, 13, 195, 157, 143, 100, 83, 176, 40, 27, 221, 181, 43, 128) // identifier redefined as global
+TRANSLATION("identifier redefined as nonlocal", 64, 150, 53, 148, 217, 13, 195, 157, 143, 100, 83, 176, 40, 10, 203, 118, 169, 92) // identifier redefined as nonlocal
+TRANSLATION("incomplete format", 34, 139, 86, 227, 23, 57, 49, 179, 63, 5, 32) // incomplete format
+TRANSLATION("incomplete format key", 42, 139, 86, 227, 23, 57, 49, 179, 63, 5, 35, 208, 252, 0) // incomplete format key
+TRANSLATION("incorrect padding", 34, 139, 86, 119, 58, 200, 193, 90, 200, 187, 128) // incorrect padding
+TRANSLATION("index out of range", 36, 139, 99, 238, 27, 50, 27, 96, 228, 187, 152) // index out of range
+TRANSLATION("indices must be integers", 48, 139, 100, 169, 192, 227, 49, 35, 83, 8, 178, 123, 155, 192) // indices must be integers
+TRANSLATION("int() arg 2 must be >= 2 and <= 36", 68, 139, 62, 207, 104, 39, 220, 127, 49, 198, 98, 70, 166, 63, 15, 234, 63, 152, 37, 176, 251, 255, 168, 254, 159, 250) // int() arg 2 must be >= 2 and <= 36
+TRANSLATION("integer required", 32, 139, 39, 185, 184, 115, 245, 202, 57, 216) // integer required
+TRANSLATION("invalid format specifier", 48, 139, 212, 174, 150, 27, 51, 240, 82, 35, 7, 84, 217, 13, 192) // invalid format specifier
+TRANSLATION("invalid micropython decorator", 58, 139, 212, 174, 150, 28, 37, 93, 177, 226, 122, 50, 139, 29, 89, 202, 89, 192) // invalid micropython decorator
+TRANSLATION("invalid syntax", 28, 139, 212, 174, 150, 17, 225, 100, 187, 128) // invalid syntax
+TRANSLATION("invalid syntax for integer", 52, 139, 212, 174, 150, 17, 225, 100, 187, 141, 153, 194, 44, 158, 230, 224) // invalid syntax for integer
+TRANSLATION("invalid syntax for integer with base %d", 78, 139, 212, 174, 150, 17, 225, 100, 187, 141, 153, 194, 44, 158, 230, 227, 178, 79, 65, 169, 65, 142, 86) // invalid syntax for integer with base %d
+TRANSLATION("invalid syntax for number", 50, 139, 212, 174, 150, 17, 225, 100, 187, 141, 153, 194, 231, 141, 77, 192) // invalid syntax for number
+TRANSLATION("issubclass() arg 1 must be a class", 68, 145, 25, 214, 183, 40, 143, 103, 180, 19, 238, 63, 144, 227, 49, 35, 83, 4, 43, 114, 136) // issubclass() arg 1 must be a class
+TRANSLATION("issubclass() arg 2 must be a class or a tuple of classes", 112, 145, 25, 214, 183, 40, 143, 103, 180, 19, 238, 63, 152, 227, 49, 35, 83, 4, 43, 114, 136, 12, 224, 132, 231, 23, 48, 219, 10, 220, 162, 14, 0) // issubclass() arg 2 must be a class or a tuple of classes
+TRANSLATION("join expects a list of str/bytes objects consistent with self object", 137, 230, 200, 160, 251, 224, 235, 48, 8, 93, 34, 67, 108, 34, 95, 236, 215, 196, 156, 6, 215, 204, 235, 48, 42, 203, 9, 18, 107, 35, 178, 79, 65, 7, 125, 131, 107, 230, 117, 144) // join expects a list of str/bytes objects consistent with self object
+TRANSLATION("keyword argument(s) not yet implemented - use normal args instead", 131, 232, 126, 59, 51, 216, 19, 239, 158, 13, 103, 217, 30, 208, 173, 35, 193, 200, 78, 49, 115, 224, 214, 78, 195, 220, 51, 6, 21, 159, 130, 184, 39, 222, 2, 44, 73, 149, 128) // keyword argument(s) not yet implemented - use normal args instead
+TRANSLATION("keywords must be strings", 49, 232, 126, 59, 51, 218, 7, 25, 137, 26, 152, 137, 116, 93, 224) // keywords must be strings
+TRANSLATION("length argument not allowed for this type", 83, 115, 93, 231, 160, 39, 223, 60, 26, 200, 86, 144, 87, 187, 118, 59, 13, 153, 196, 244, 72, 19, 227, 6) // length argument not allowed for this type
+TRANSLATION("local variable referenced before assignment", 87, 118, 169, 92, 117, 39, 66, 214, 230, 28, 246, 55, 53, 169, 216, 106, 123, 51, 152, 40, 132, 221, 120, 53, 144) // local variable referenced before assignment
+TRANSLATION("maximum recursion depth exceeded", 65, 193, 119, 78, 51, 192, 115, 174, 94, 17, 148, 88, 241, 61, 1, 247, 169, 157, 142, 192) // maximum recursion depth exceeded
+TRANSLATION("memory allocation failed, allocating %u bytes", 91, 193, 240, 207, 224, 21, 238, 213, 41, 70, 81, 177, 37, 206, 223, 88, 43, 221, 170, 82, 139, 184, 229, 145, 175, 137, 56) // memory allocation failed, allocating %u bytes
+TRANSLATION("memory allocation failed, heap is locked", 81, 193, 240, 207, 224, 21, 238, 213, 41, 70, 81, 177, 37, 206, 223, 88, 232, 101, 128, 144, 46, 213, 244, 59, 0) // memory allocation failed, heap is locked
+TRANSLATION("module not found", 33, 195, 91, 55, 48, 173, 35, 102, 202, 216) // module not found
+TRANSLATION("multiple *x in assignment", 51, 198, 111, 41, 139, 152, 250, 187, 132, 80, 81, 9, 186, 240, 107, 32) // multiple *x in assignment
+TRANSLATION("multiple bases have instance lay-out conflict", 91, 198, 111, 41, 139, 152, 212, 160, 224, 116, 46, 166, 17, 98, 73, 106, 98, 229, 227, 220, 217, 145, 86, 93, 174, 149, 144) // multiple bases have instance lay-out conflict
+TRANSLATION("must use keyword argument for key function", 85, 198, 98, 70, 96, 199, 161, 248, 236, 207, 96, 79, 190, 120, 53, 145, 179, 56, 244, 63, 3, 108, 173, 101, 25, 64) // must use keyword argument for key function
+TRANSLATION("name '%q' is not defined", 48, 165, 193, 141, 57, 122, 232, 18, 2, 180, 139, 30, 200, 167, 96) // name \'%q\' is not defined
+TRANSLATION("name not defined", 32, 165, 193, 133, 105, 22, 61, 145, 78, 192) // name not defined
+TRANSLATION("name reused for argument", 48, 165, 193, 135, 60, 193, 216, 108, 206, 9, 247, 207, 6, 178) // name reused for argument
+TRANSLATION("need more than %d values to unpack", 68, 166, 118, 28, 51, 152, 158, 132, 163, 149, 135, 82, 190, 78, 4, 176, 202, 224, 171, 232) // need more than %d values to unpack
+TRANSLATION("negative shift count", 40, 167, 185, 74, 117, 49, 29, 19, 105, 21, 108, 172, 128) // negative shift count
+TRANSLATION("no active exception to reraise", 60, 172, 10, 178, 157, 76, 31, 122, 158, 37, 25, 68, 176, 115, 114, 72, 48) // no active exception to reraise
+TRANSLATION("no binding for nonlocal found", 58, 172, 53, 69, 178, 46, 227, 102, 112, 172, 183, 106, 149, 198, 205, 149, 176) // no binding for nonlocal found
+TRANSLATION("no module named '%q'", 40, 172, 56, 107, 102, 230, 20, 184, 59, 13, 57, 122, 232) // no module named \'%q\'
+TRANSLATION("no such attribute", 34, 172, 35, 53, 232, 10, 101, 211, 92, 201, 128) // no such attribute
+TRANSLATION("non-default argument follows default argument", 90, 172, 190, 235, 30, 197, 155, 200, 39, 223, 60, 26, 200, 217, 175, 118, 237, 2, 199, 177, 102, 242, 9, 247, 207, 6, 178) // non-default argument follows default argument
+TRANSLATION("non-hex digit found", 38, 172, 190, 238, 135, 220, 89, 55, 73, 27, 54, 86, 192) // non-hex digit found
+TRANSLATION("non-keyword arg after */**", 52, 172, 190, 239, 67, 241, 217, 158, 192, 159, 112, 91, 73, 184, 250, 190, 207, 171, 234) // non-keyword arg after */**
+TRANSLATION("non-keyword arg after keyword arg", 66, 172, 190, 239, 67, 241, 217, 158, 192, 159, 112, 91, 73, 184, 244, 63, 29, 153, 236, 9, 247) // non-keyword arg after keyword arg
+TRANSLATION("not all arguments converted during string formatting", 104, 173, 32, 175, 112, 79, 190, 120, 53, 152, 21, 101, 234, 111, 39, 97, 108, 186, 46, 226, 37, 209, 119, 27, 51, 240, 83, 40, 187, 128) // not all arguments converted during string formatting
+TRANSLATION("not enough arguments for format string", 76, 173, 32, 213, 179, 191, 64, 79, 190, 120, 53, 152, 27, 51, 141, 153, 248, 41, 17, 46, 139, 184) // not enough arguments for format string
+TRANSLATION("object '%s' is not a tuple or list", 68, 218, 249, 157, 100, 105, 202, 52, 9, 1, 90, 65, 9, 206, 46, 97, 156, 93, 34, 64) // object \'%s\' is not a tuple or list
+TRANSLATION("object does not support item assignment", 78, 218, 249, 157, 100, 89, 142, 2, 180, 136, 206, 48, 207, 33, 36, 248, 5, 16, 155, 175, 6, 178) // object does not support item assignment
+TRANSLATION("object does not support item deletion", 74, 218, 249, 157, 100, 89, 142, 2, 180, 136, 206, 48, 207, 33, 36, 248, 22, 59, 156, 163, 40) // object does not support item deletion
+TRANSLATION("object has no len", 34, 218, 249, 157, 100, 116, 40, 10, 194, 230, 160) // object has no len
+TRANSLATION("object is not subscriptable", 54, 218, 249, 157, 100, 36, 5, 105, 17, 157, 98, 174, 152, 146, 214, 230) // object is not subscriptable
+TRANSLATION("object not an iterator", 44, 218, 249, 157, 100, 43, 72, 37, 9, 38, 229, 44, 224) // object not an iterator
+TRANSLATION("object not callable", 38, 218, 249, 157, 100, 43, 72, 169, 94, 229, 173, 204) // object not callable
+TRANSLATION("object not in sequence", 44, 218, 249, 157, 100, 43, 72, 69, 16, 126, 185, 53, 169, 128) // object not in sequence
+TRANSLATION("object not iterable", 38, 218, 249, 157, 100, 43, 72, 73, 55, 45, 110, 96) // object not iterable
+TRANSLATION("object of type '%s' has no len()", 64, 218, 249, 157, 100, 54, 194, 124, 96, 198, 156, 163, 65, 208, 160, 43, 11, 154, 251, 61, 160) // object of type \'%s\' has no len()
+TRANSLATION("object with buffer protocol required", 72, 218, 249, 157, 100, 118, 73, 232, 53, 206, 219, 27, 140, 59, 75, 85, 174, 28, 253, 114, 142, 118) // object with buffer protocol required
+TRANSLATION("odd-length string", 34, 214, 183, 186, 230, 187, 207, 65, 18, 232, 187, 128) // odd-length string
+TRANSLATION("offset out of bounds", 40, 219, 109, 7, 33, 179, 33, 182, 26, 182, 86, 208) // offset out of bounds
+TRANSLATION("only slices with step=1 (aka None) are supported", 96, 203, 127, 2, 46, 149, 56, 29, 146, 122, 8, 147, 199, 245, 254, 67, 216, 94, 132, 60, 153, 79, 218, 9, 204, 70, 113, 134, 121, 59, 0) // only slices with step=1 (aka None) are supported
+TRANSLATION("ord expects a character", 46, 207, 96, 125, 240, 117, 152, 4, 43, 208, 156, 171, 38, 224) // ord expects a character
+TRANSLATION("ord() expected a character, but string of length %d found", 114, 207, 111, 103, 180, 31, 124, 29, 100, 236, 8, 87, 161, 57, 86, 77, 254, 177, 174, 100, 68, 186, 46, 225, 182, 23, 53, 222, 122, 14, 86, 27, 54, 86, 192) // ord() expected a character, but string of length %d found
+TRANSLATION("overflow converting long int to machine word", 88, 221, 77, 246, 187, 118, 21, 101, 234, 111, 40, 187, 139, 178, 238, 17, 100, 75, 14, 10, 189, 17, 76, 118, 103, 176) // overflow converting long int to machine word
+TRANSLATION("pop from an empty set", 43, 134, 192, 217, 219, 128, 74, 15, 140, 79, 129, 7, 32) // pop from an empty set
+TRANSLATION("pop from empty list", 39, 134, 192, 217, 219, 128, 124, 98, 124, 11, 164, 72) // pop from empty list
+TRANSLATION("popitem(): dictionary is empty", 61, 134, 194, 73, 241, 236, 246, 253, 194, 201, 89, 70, 82, 127, 1, 32, 31, 24, 159, 0) // popitem(): dictionary is empty
+TRANSLATION("raw f-strings are not implemented", 66, 229, 216, 109, 238, 137, 116, 93, 224, 19, 152, 86, 144, 156, 98, 231, 193, 172, 157, 128) // raw f-strings are not implemented
+TRANSLATION("requested length %d but object has length %d", 88, 231, 235, 147, 137, 59, 11, 154, 239, 61, 7, 43, 13, 115, 33, 181, 243, 58, 200, 232, 80, 46, 107, 188, 244, 28, 172) // requested length %d but object has length %d
+TRANSLATION("rsplit(None,n)", 28, 241, 139, 164, 251, 60, 153, 79, 235, 95, 104) // rsplit(None,n)
+TRANSLATION("sign not allowed in string format specifier", 87, 9, 186, 133, 105, 5, 123, 183, 99, 176, 69, 17, 46, 139, 184, 217, 159, 130, 145, 24, 58, 166, 200, 110) // sign not allowed in string format specifier
+TRANSLATION("sign not allowed with integer format specifier 'c'", 101, 9, 186, 133, 105, 5, 123, 183, 99, 176, 236, 147, 208, 34, 201, 238, 110, 54, 103, 224, 164, 70, 14, 169, 178, 27, 141, 43, 160) // sign not allowed with integer format specifier \'c\'
+TRANSLATION("single '}' encountered in format string", 79, 8, 187, 220, 198, 159, 239, 64, 107, 86, 202, 201, 185, 216, 34, 141, 153, 248, 41, 17, 46, 139, 184) // single \'}\' encountered in format string
+TRANSLATION("slice step cannot be zero", 51, 23, 74, 152, 137, 60, 10, 146, 171, 72, 212, 199, 238, 110, 192) // slice step cannot be zero
+TRANSLATION("small int overflow", 37, 28, 21, 238, 17, 100, 55, 83, 125, 174, 221, 128) // small int overflow
+TRANSLATION("start/end indices", 35, 18, 79, 63, 97, 173, 130, 45, 146, 167, 0) // start/end indices
+TRANSLATION("stream operation not supported", 61, 18, 230, 92, 6, 193, 185, 74, 50, 133, 105, 17, 156, 97, 158, 78, 192) // stream operation not supported
+TRANSLATION("string index out of range", 51, 18, 232, 187, 132, 91, 31, 112, 217, 144, 219, 7, 37, 220, 192) // string index out of range
+TRANSLATION("string indices must be integers, not %s", 79, 18, 232, 187, 132, 91, 37, 78, 7, 25, 137, 26, 152, 69, 147, 220, 222, 62, 176, 173, 35, 148, 0) // string indices must be integers, not %s
+TRANSLATION("string not supported; use bytes or bytearray", 89, 18, 232, 187, 133, 105, 17, 156, 97, 158, 78, 223, 252, 25, 131, 26, 248, 147, 128, 206, 53, 241, 38, 78, 229, 224) // string not supported; use bytes or bytearray
+TRANSLATION("substring not found", 39, 25, 214, 37, 209, 119, 10, 210, 54, 108, 173, 128) // substring not found
+TRANSLATION("super() can't find self", 47, 25, 193, 191, 179, 218, 42, 75, 164, 141, 145, 108, 32, 239, 176) // super() can\'t find self
+TRANSLATION("too many values to unpack (expected %d)", 79, 44, 195, 130, 95, 3, 169, 95, 39, 2, 88, 101, 112, 85, 244, 30, 195, 239, 131, 172, 157, 135, 43, 123, 64) // too many values to unpack (expected %d)
+TRANSLATION("tuple index out of range", 49, 57, 197, 204, 34, 216, 251, 134, 204, 134, 216, 57, 46, 230) // tuple index out of range
+TRANSLATION("tuple/list has wrong length", 55, 57, 197, 207, 236, 186, 68, 142, 133, 3, 179, 178, 238, 46, 107, 188, 244) // tuple/list has wrong length
+TRANSLATION("type '%q' is not an acceptable base type", 81, 62, 48, 99, 78, 94, 186, 4, 128, 173, 32, 148, 21, 106, 120, 146, 214, 230, 53, 40, 49, 62, 48, 96) // type \'%q\' is not an acceptable base type
+TRANSLATION("type is not an acceptable base type", 71, 62, 48, 97, 32, 43, 72, 37, 5, 90, 158, 36, 181, 185, 141, 74, 12, 79, 140, 24) // type is not an acceptable base type
+TRANSLATION("type object '%q' has no attribute '%q'", 77, 62, 48, 97, 181, 243, 58, 200, 211, 151, 174, 131, 161, 64, 86, 5, 50, 233, 174, 100, 198, 156, 189, 116) // type object \'%q\' has no attribute \'%q\'
+TRANSLATION("type takes 1 or 3 arguments", 55, 62, 48, 98, 75, 208, 224, 127, 32, 206, 63, 160, 39, 223, 60, 26, 204, 0) // type takes 1 or 3 arguments
+TRANSLATION("unexpected indent", 35, 149, 62, 248, 58, 201, 216, 34, 216, 214, 64) // unexpected indent
+TRANSLATION("unexpected keyword argument '%q'", 65, 149, 62, 248, 58, 201, 216, 122, 31, 142, 204, 246, 4, 251, 231, 131, 89, 26, 114, 245, 208) // unexpected keyword argument \'%q\'
+TRANSLATION("unicode name escapes", 41, 149, 74, 181, 140, 41, 112, 96, 226, 165, 131, 128) // unicode name escapes
+TRANSLATION("unindent does not match any outer indentation level", 103, 149, 69, 177, 172, 139, 49, 192, 86, 145, 193, 77, 122, 2, 95, 1, 179, 38, 225, 22, 198, 178, 82, 140, 162, 231, 212, 238) // unindent does not match any outer indentation level
+TRANSLATION("unknown conversion specifier %c", 63, 149, 244, 86, 236, 162, 172, 189, 77, 225, 25, 68, 96, 234, 155, 33, 184, 229, 80) // unknown conversion specifier %c
+TRANSLATION("unknown format code '%c' for object of type '%s'", 97, 149, 244, 86, 236, 163, 102, 126, 10, 69, 90, 198, 52, 229, 93, 6, 204, 225, 181, 243, 58, 200, 109, 132, 248, 193, 141, 57, 70, 128) // unknown format code \'%c\' for object of type \'%s\'
+TRANSLATION("unmatched '{' in format", 47, 149, 224, 166, 189, 14, 195, 79, 252, 208, 34, 141, 153, 248, 41) // unmatched \'{\' in format
+TRANSLATION("unreadable attribute", 41, 149, 115, 43, 22, 183, 48, 83, 46, 154, 230, 76) // unreadable attribute
+TRANSLATION("unsupported format character '%c' (0x%x) at index %d", 105, 149, 140, 227, 12, 242, 118, 27, 51, 240, 82, 43, 208, 156, 171, 38, 227, 78, 85, 208, 123, 62, 222, 252, 187, 251, 65, 72, 69, 177, 247, 28, 172) // unsupported format character \'%c\' (0x%x) at index %d
+TRANSLATION("unsupported type for %q: '%s'", 59, 149, 140, 227, 12, 242, 118, 19, 227, 6, 54, 103, 28, 189, 126, 225, 167, 40, 208) // unsupported type for %q: \'%s\'
+TRANSLATION("unsupported type for operator", 59, 149, 140, 227, 12, 242, 118, 19, 227, 6, 54, 103, 13, 131, 114, 150, 112) // unsupported type for operator
+TRANSLATION("unsupported types for %q: '%s', '%s'", 73, 149, 140, 227, 12, 242, 118, 19, 227, 7, 3, 102, 113, 203, 215, 238, 26, 114, 141, 62, 177, 167, 40, 208) // unsupported types for %q: \'%s\', \'%s\'
+TRANSLATION("value must fit in %d byte(s)", 57, 212, 175, 147, 28, 102, 36, 108, 146, 17, 71, 43, 13, 124, 73, 251, 35, 218) // value must fit in %d byte(s)
+TRANSLATION("wrong number of arguments", 51, 217, 217, 119, 11, 158, 53, 55, 13, 176, 39, 223, 60, 26, 204, 0) // wrong number of arguments
+TRANSLATION("wrong number of values to unpack", 65, 217, 217, 119, 11, 158, 53, 55, 13, 176, 234, 87, 201, 192, 150, 25, 92, 21, 125, 0) // wrong number of values to unpack
+TRANSLATION("zero step", 19, 251, 155, 176, 137, 60, 0) // zero step
+
+// 2119 bytes worth of qstr
+// 6597 bytes worth of translations
+// 4078 bytes worth of translations compressed
+// 2519 bytes saved
@@ -93,6 +93,15 @@ static int32_t convert_block_to_flash_addr(uint32_t block) {
     return -1;
 }
 
+const uint8_t* supervisor_flash_get_block_address(uint32_t block) {
+    // Writes go straight to flash so there is nothing to flush.
+    int32_t src = convert_block_to_flash_addr(block);
+    if (src == -1) {
+        return NULL;
+    }
+    return (const uint8_t*) src;
+}
+
 bool supervisor_flash_read_block(uint8_t *dest, uint32_t block) {
     // non-MBR block, get data from flash memory
     int32_t src = convert_block_to_flash_addr(block);
@@ -70,6 +70,11 @@ void port_internal_flash_flush(void) {
     flash_sector = NO_SECTOR;
 }
 
+const uint8_t* supervisor_flash_get_block_address(uint32_t block) {
+    // The flash is only read through the flash manager.
+    return NULL;
+}
+
 mp_uint_t supervisor_flash_read_blocks(uint8_t *dest, uint32_t block, uint32_t num_blocks) {
     supervisor_flash_flush();
 
@@ -73,6 +73,11 @@ void port_internal_flash_flush(void) {
 STATIC uint8_t _cache[SECTOR_SIZE];
 STATIC uint32_t _cache_lba;
 
+const uint8_t* supervisor_flash_get_block_address(uint32_t block) {
+    // The partition isn't mapped into the address space.
+    return NULL;
+}
+
 mp_uint_t supervisor_flash_read_blocks(uint8_t *dest, uint32_t block, uint32_t num_blocks) {
     esp_err_t ok = esp_partition_read(_partition,
                                       block * FILESYSTEM_BLOCK_SIZE,
@@ -332,6 +332,9 @@ void i2s_background(void) {
         } else {
             NRF_I2S->TASKS_STOP = 1;
         }
+    } else if (instance && instance->playing && !instance->paused) {
+        // Let the sample read ahead while the current buffer plays.
+        audiosample_prefetch(instance->sample);
     }
 }
 
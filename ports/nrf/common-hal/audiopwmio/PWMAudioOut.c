@@ -164,16 +164,22 @@ STATIC void audiopwmout_background_obj(audiopwmio_pwmaudioout_obj_t *self) {
 
 void audiopwmout_background() {
     // Check the NVIC first because it is part of the CPU and fast to read.
-    if (!NVIC_GetPendingIRQ(PWM0_IRQn) &&
-        !NVIC_GetPendingIRQ(PWM1_IRQn) &&
-        !NVIC_GetPendingIRQ(PWM2_IRQn) &&
-        !NVIC_GetPendingIRQ(PWM3_IRQn)) {
-        return;
+    if (NVIC_GetPendingIRQ(PWM0_IRQn) ||
+        NVIC_GetPendingIRQ(PWM1_IRQn) ||
+        NVIC_GetPendingIRQ(PWM2_IRQn) ||
+        NVIC_GetPendingIRQ(PWM3_IRQn)) {
+        // Check our objects because the PWM could be active for some other reason.
+        for (size_t i=0; i < MP_ARRAY_SIZE(active_audio); i++) {
+            if (!active_audio[i]) continue;
+            audiopwmout_background_obj(active_audio[i]);
+        }
     }
-    // Check our objects because the PWM could be active for some other reason.
+    // Let the samples read ahead while their current buffers play.
     for (size_t i=0; i < MP_ARRAY_SIZE(active_audio); i++) {
-        if (!active_audio[i]) continue;
-        audiopwmout_background_obj(active_audio[i]);
+        audiopwmio_pwmaudioout_obj_t *self = active_audio[i];
+        if (!self || !common_hal_audiopwmio_pwmaudioout_get_playing(self) ||
+            self->paused || self->stopping || self->single_buffer) continue;
+        audiosample_prefetch(self->sample);
     }
 }
 
@@ -78,6 +78,15 @@ void port_internal_flash_flush(void) {
     }
 }
 
+const uint8_t* supervisor_flash_get_block_address(uint32_t block) {
+    if (block >= supervisor_flash_get_block_count()) {
+        return NULL;
+    }
+    // Must write out anything in cache before it can be read.
+    supervisor_flash_flush();
+    return (const uint8_t*) lba2addr(block);
+}
+
 mp_uint_t supervisor_flash_read_blocks(uint8_t *dest, uint32_t block, uint32_t num_blocks) {
     // Must write out anything in cache before trying to read.
     supervisor_flash_flush();
@@ -245,6 +245,16 @@ static uint32_t convert_block_to_flash_addr(uint32_t block) {
     return -1;
 }
 
+const uint8_t* supervisor_flash_get_block_address(uint32_t block) {
+    int32_t src = convert_block_to_flash_addr(block);
+    if (src == -1) {
+        return NULL;
+    }
+    // Must write out anything in cache before it can be read.
+    supervisor_flash_flush();
+    return (const uint8_t*) src;
+}
+
 mp_uint_t supervisor_flash_read_blocks(uint8_t *dest, uint32_t block, uint32_t num_blocks) {
     int32_t src = convert_block_to_flash_addr(block);
     if (src == -1) {
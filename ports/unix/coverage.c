@@ -1,4 +1,6 @@
+#include <math.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "py/obj.h"
@@ -13,6 +15,18 @@
 #include "py/stream.h"
 #include "py/binary.h"
 #include "py/bc.h"
+#include "py/mphal.h"
+#include "extmod/vfs_fat.h"
+#include "lib/oofatfs/ff.h"
+#include "shared-bindings/audiocore/SampleQueue.h"
+#include "shared-bindings/audiocore/WaveFile.h"
+#include "shared-bindings/audiomixer/Effects.h"
+#include "shared-bindings/audiomixer/Mixer.h"
+#include "shared-bindings/audiomixer/MixerVoice.h"
+#include "shared-bindings/displayio/Bitmap.h"
+#include "shared-bindings/displayio/Palette.h"
+#include "shared-bindings/displayio/TileGrid.h"
+#include "supervisor/flash.h"
 
 #if defined(MICROPY_UNIX_COVERAGE)
 
@@ -140,6 +154,602 @@ STATIC const mp_obj_type_t mp_type_stest_textio2 = {
 STATIC const mp_obj_str_t str_no_hash_obj = {{&mp_type_str}, 0, 10, (const byte*)"0123456789"};
 STATIC const mp_obj_str_t bytes_no_hash_obj = {{&mp_type_bytes}, 0, 10, (const byte*)"0123456789"};
 
+// mock audio sample playing a sine wave, read in small chunks
+typedef struct _mock_audio_format_t {
+    uint32_t sample_rate;
+    uint8_t channel_count;
+    uint8_t bits_per_sample;
+    bool samples_signed;
+} mock_audio_format_t;
+
+typedef struct _mock_sine_sample_t {
+    mp_obj_base_t base;
+    mock_audio_format_t format;
+    uint8_t *data;
+    uint32_t length;
+    uint32_t pos;
+} mock_sine_sample_t;
+
+#define MOCK_SINE_FREQUENCY (440)
+#define MOCK_SINE_CHUNK (100)
+
+// the second channel plays at half the level of the first
+STATIC double mock_sine_value(uint8_t channel, double frame, uint32_t sample_rate) {
+    double level = channel == 0 ? 0.75 : 0.375;
+    return level * sin(2 * M_PI * MOCK_SINE_FREQUENCY * frame / sample_rate);
+}
+
+STATIC uint32_t mock_sine_sample_rate(mp_obj_t self_in) {
+    mock_sine_sample_t *self = MP_OBJ_TO_PTR(self_in);
+    return self->format.sample_rate;
+}
+
+STATIC uint8_t mock_sine_bits_per_sample(mp_obj_t self_in) {
+    mock_sine_sample_t *self = MP_OBJ_TO_PTR(self_in);
+    return self->format.bits_per_sample;
+}
+
+STATIC uint8_t mock_sine_channel_count(mp_obj_t self_in) {
+    mock_sine_sample_t *self = MP_OBJ_TO_PTR(self_in);
+    return self->format.channel_count;
+}
+
+STATIC void mock_sine_reset_buffer(mp_obj_t self_in, bool single_channel, uint8_t channel) {
+    mock_sine_sample_t *self = MP_OBJ_TO_PTR(self_in);
+    self->pos = 0;
+}
+
+STATIC audioio_get_buffer_result_t mock_sine_get_buffer(mp_obj_t self_in, bool single_channel,
+    uint8_t channel, uint8_t **buffer, uint32_t *buffer_length) {
+    mock_sine_sample_t *self = MP_OBJ_TO_PTR(self_in);
+    *buffer = self->data + self->pos;
+    *buffer_length = MIN(self->length - self->pos, MOCK_SINE_CHUNK);
+    self->pos += *buffer_length;
+    return self->pos < self->length ? GET_BUFFER_MORE_DATA : GET_BUFFER_DONE;
+}
+
+STATIC void mock_sine_get_buffer_structure(mp_obj_t self_in, bool single_channel,
+    bool *single_buffer, bool *samples_signed, uint32_t *max_buffer_length, uint8_t *spacing) {
+    mock_sine_sample_t *self = MP_OBJ_TO_PTR(self_in);
+    *single_buffer = false;
+    *samples_signed = self->format.samples_signed;
+    *max_buffer_length = MOCK_SINE_CHUNK;
+    *spacing = 1;
+}
+
+STATIC const audiosample_p_t mock_sine_proto = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_audiosample)
+    .sample_rate = mock_sine_sample_rate,
+    .bits_per_sample = mock_sine_bits_per_sample,
+    .channel_count = mock_sine_channel_count,
+    .reset_buffer = mock_sine_reset_buffer,
+    .get_buffer = mock_sine_get_buffer,
+    .get_buffer_structure = mock_sine_get_buffer_structure,
+};
+
+STATIC const mp_obj_type_t mock_sine_sample_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_SineSample,
+    .protocol = &mock_sine_proto,
+};
+
+// Returns a sample from a buffer scaled to signed 16 bits.
+STATIC int32_t mock_audio_read(const mock_audio_format_t *format, const uint8_t *buffer, uint32_t index) {
+    if (format->bits_per_sample == 16) {
+        uint16_t raw = ((const uint16_t*) buffer)[index];
+        return format->samples_signed ? (int16_t) raw : (int16_t) (raw - 0x8000);
+    }
+    uint8_t raw = buffer[index];
+    return (format->samples_signed ? (int8_t) raw : (int8_t) (raw - 0x80)) * 256;
+}
+
+STATIC void mock_audio_write(const mock_audio_format_t *format, uint8_t *buffer, uint32_t index, double value) {
+    if (format->bits_per_sample == 16) {
+        int16_t v = lround(value * INT16_MAX);
+        ((uint16_t*) buffer)[index] = format->samples_signed ? (uint16_t) v : (uint16_t) (v + 0x8000);
+    } else {
+        int8_t v = lround(value * INT8_MAX);
+        buffer[index] = format->samples_signed ? (uint8_t) v : (uint8_t) (v + 0x80);
+    }
+}
+
+STATIC mock_sine_sample_t *mock_sine_sample_new(const mock_audio_format_t *format, uint32_t frames) {
+    mock_sine_sample_t *sample = m_new_obj(mock_sine_sample_t);
+    sample->base.type = &mock_sine_sample_type;
+    sample->format = *format;
+    sample->length = frames * format->channel_count * format->bits_per_sample / 8;
+    sample->data = m_new(uint8_t, sample->length);
+    for (uint32_t i = 0; i < frames; i++) {
+        for (uint8_t c = 0; c < format->channel_count; c++) {
+            mock_audio_write(format, sample->data, i * format->channel_count + c,
+                mock_sine_value(c, i, format->sample_rate));
+        }
+    }
+    return sample;
+}
+
+// Plays a sine sample through a mixer of another format and compares the
+// mixer's output against the sine at the mixer's rate, after the resampling
+// history has filled. The polyphase filter delays the voice by three frames.
+// The tolerance is in signed 16 bit units and allows for 8 bit quantisation.
+STATIC void mock_mixer_play(const mock_audio_format_t *sample_format,
+    const mock_audio_format_t *mixer_format, bool polyphase, int32_t tolerance) {
+    const uint32_t frames = 256;
+    const uint32_t settle = 16;
+
+    uint32_t sample_frames = (uint64_t) frames * sample_format->sample_rate / mixer_format->sample_rate + 16;
+    mock_sine_sample_t *sample = mock_sine_sample_new(sample_format, sample_frames);
+
+    audiomixer_mixer_obj_t *mixer = m_new_obj_var(audiomixer_mixer_obj_t, mp_obj_t, 1);
+    common_hal_audiomixer_mixer_construct(mixer, 1, 256, mixer_format->bits_per_sample,
+        mixer_format->samples_signed, mixer_format->channel_count, mixer_format->sample_rate, polyphase);
+    audiomixer_mixervoice_obj_t *voice = m_new_obj(audiomixer_mixervoice_obj_t);
+    common_hal_audiomixer_mixervoice_construct(voice);
+    common_hal_audiomixer_mixervoice_set_parent(voice, mixer);
+    mixer->voice[0] = MP_OBJ_FROM_PTR(voice);
+    common_hal_audiomixer_mixervoice_play(voice, MP_OBJ_FROM_PTR(sample), false);
+
+    uint8_t channel_count = mixer_format->channel_count;
+    uint32_t frame_length = channel_count * mixer_format->bits_per_sample / 8;
+    int32_t max_error = 0;
+    for (uint32_t i = 0; i < frames;) {
+        uint8_t *buffer;
+        uint32_t buffer_length;
+        audiomixer_mixer_get_buffer(mixer, false, 0, &buffer, &buffer_length);
+        for (uint32_t j = 0; j < buffer_length / frame_length && i < frames; j++, i++) {
+            double position = (double) i * voice->step / (1 << 16) - (polyphase ? 3 : 0);
+            for (uint8_t c = 0; c < channel_count; c++) {
+                double expected;
+                if (sample_format->channel_count == channel_count) {
+                    expected = mock_sine_value(c, position, sample_format->sample_rate);
+                } else if (channel_count == 1) {
+                    expected = (mock_sine_value(0, position, sample_format->sample_rate) +
+                        mock_sine_value(1, position, sample_format->sample_rate)) / 2;
+                } else {
+                    expected = mock_sine_value(0, position, sample_format->sample_rate);
+                }
+                int32_t error = abs(mock_audio_read(mixer_format, buffer, j * channel_count + c) -
+                    (int32_t) lround(expected * INT16_MAX));
+                if (i >= settle && error > max_error) {
+                    max_error = error;
+                }
+            }
+        }
+    }
+    mp_printf(&mp_plat_print, "%u/%u/%u%c -> %u/%u/%u%c %s: %s\n",
+        (uint)sample_format->sample_rate, sample_format->channel_count, sample_format->bits_per_sample,
+        sample_format->samples_signed ? 's' : 'u',
+        (uint)mixer_format->sample_rate, mixer_format->channel_count, mixer_format->bits_per_sample,
+        mixer_format->samples_signed ? 's' : 'u',
+        polyphase ? "polyphase" : "linear",
+        common_hal_audiomixer_mixervoice_get_playing(voice) && max_error <= tolerance ? "ok" : "bad");
+}
+
+#define MOCK_EFFECTS_FRAMES (601)
+#define MOCK_EFFECTS_BUFFER_SIZE (512)
+
+STATIC audiomixer_effects_obj_t *mock_effects_new(mock_sine_sample_t *sample) {
+    audiomixer_effects_obj_t *effects = m_new_obj(audiomixer_effects_obj_t);
+    common_hal_audiomixer_effects_construct(effects, MP_OBJ_FROM_PTR(sample), MOCK_EFFECTS_BUFFER_SIZE, 100);
+    return effects;
+}
+
+// Reads everything an Effects sample produces into out. Returns the number of samples.
+STATIC uint32_t mock_effects_read(audiomixer_effects_obj_t *effects, int16_t *out, uint32_t max_count) {
+    uint32_t count = 0;
+    audioio_get_buffer_result_t result = GET_BUFFER_MORE_DATA;
+    while (result == GET_BUFFER_MORE_DATA) {
+        uint8_t *buffer;
+        uint32_t buffer_length;
+        result = audiomixer_effects_get_buffer(effects, false, 0, &buffer, &buffer_length);
+        uint32_t n = MIN(buffer_length / sizeof(int16_t), max_count - count);
+        memcpy(out + count, buffer, n * sizeof(int16_t));
+        count += n;
+    }
+    return count;
+}
+
+// Compares everything an Effects sample produces with a floating point model of its stages,
+// allowing for the rounding of the fixed point stages.
+STATIC void mock_effects_compare(const char *name, audiomixer_effects_obj_t *effects,
+    const double *expected, int32_t tolerance) {
+    int16_t *out = m_new(int16_t, MOCK_EFFECTS_FRAMES * 2);
+    uint32_t count = mock_effects_read(effects, out, MOCK_EFFECTS_FRAMES * 2);
+    int32_t max_error = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        int32_t e = MIN(MAX(lround(expected[i]), INT16_MIN), INT16_MAX);
+        max_error = MAX(max_error, abs(out[i] - e));
+    }
+    mp_printf(&mp_plat_print, "effects %s: %s\n", name,
+        count == MOCK_EFFECTS_FRAMES * 2 && max_error <= tolerance ? "ok" : "bad");
+    m_del(int16_t, out, MOCK_EFFECTS_FRAMES * 2);
+}
+
+// A FAT formatted RAM disk standing in for a board's filesystem.
+#define MOCK_DISK_BLOCK_COUNT (128)
+
+STATIC uint8_t mock_disk[MOCK_DISK_BLOCK_COUNT][FILESYSTEM_BLOCK_SIZE];
+STATIC fs_user_mount_t mock_disk_vfs;
+
+STATIC mp_uint_t mock_disk_read_blocks(uint8_t *dest, uint32_t block_num, uint32_t num_blocks) {
+    memcpy(dest, mock_disk[block_num], num_blocks * FILESYSTEM_BLOCK_SIZE);
+    return 0;
+}
+
+STATIC mp_uint_t mock_disk_write_blocks(const uint8_t *src, uint32_t block_num, uint32_t num_blocks) {
+    memcpy(mock_disk[block_num], src, num_blocks * FILESYSTEM_BLOCK_SIZE);
+    return 0;
+}
+
+STATIC mp_obj_t mock_disk_ioctl(mp_obj_t cmd_in, mp_obj_t arg_in) {
+    switch (mp_obj_get_int(cmd_in)) {
+        case BP_IOCTL_SEC_COUNT: return MP_OBJ_NEW_SMALL_INT(MOCK_DISK_BLOCK_COUNT);
+        case BP_IOCTL_SEC_SIZE: return MP_OBJ_NEW_SMALL_INT(FILESYSTEM_BLOCK_SIZE);
+        default: return MP_OBJ_NEW_SMALL_INT(0);
+    }
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(mock_disk_ioctl_obj, mock_disk_ioctl);
+
+STATIC void mock_disk_init(void) {
+    mock_disk_vfs.base.type = &mp_fat_vfs_type;
+    mock_disk_vfs.flags = FSUSER_NATIVE | FSUSER_HAVE_IOCTL;
+    mock_disk_vfs.fatfs.drv = &mock_disk_vfs;
+    // Only the native block functions are called but writeblocks[0] marks the disk writable.
+    mock_disk_vfs.readblocks[0] = mp_const_none;
+    mock_disk_vfs.readblocks[2] = (mp_obj_t)mock_disk_read_blocks;
+    mock_disk_vfs.writeblocks[0] = mp_const_none;
+    mock_disk_vfs.writeblocks[2] = (mp_obj_t)mock_disk_write_blocks;
+    mock_disk_vfs.u.ioctl[0] = MP_OBJ_FROM_PTR(&mock_disk_ioctl_obj);
+    mock_disk_vfs.u.ioctl[1] = MP_OBJ_NULL;
+    uint8_t *work = m_new(uint8_t, FILESYSTEM_BLOCK_SIZE);
+    f_mkfs(&mock_disk_vfs.fatfs, FM_FAT | FM_SFD, 0, work, FILESYSTEM_BLOCK_SIZE);
+    m_del(uint8_t, work, FILESYSTEM_BLOCK_SIZE);
+    f_mount(&mock_disk_vfs.fatfs);
+}
+
+// The mock disk is mapped like internal flash, so WaveFiles on it can be played from it directly.
+const uint8_t* supervisor_flash_get_vfs_block_address(fs_user_mount_t *vfs, uint32_t block_num) {
+    if (vfs != &mock_disk_vfs || block_num >= MOCK_DISK_BLOCK_COUNT) {
+        return NULL;
+    }
+    return mock_disk[block_num];
+}
+
+// Writes a 16 bit wave file whose samples count up from 1 and opens it to be played.
+STATIC pyb_file_obj_t *mock_wavefile_open(const char *path, uint16_t channel_count, uint32_t data_length) {
+    struct {
+        char riff[4];
+        uint32_t riff_length;
+        char wave_fmt[8];
+        uint32_t format_length;
+        uint16_t audio_format;
+        uint16_t channel_count;
+        uint32_t sample_rate;
+        uint32_t byte_rate;
+        uint16_t block_align;
+        uint16_t bits_per_sample;
+        char data[4];
+        uint32_t data_length;
+    } header = {
+        {'R', 'I', 'F', 'F'}, 36 + data_length, {'W', 'A', 'V', 'E', 'f', 'm', 't', ' '}, 16,
+        1, channel_count, 22050, 22050 * 2 * channel_count, 2 * channel_count, 16,
+        {'d', 'a', 't', 'a'}, data_length,
+    };
+    pyb_file_obj_t *file = m_new_obj(pyb_file_obj_t);
+    file->base.type = &mp_type_vfs_fat_fileio;
+    UINT written;
+    f_open(&mock_disk_vfs.fatfs, &file->fp, path, FA_WRITE | FA_CREATE_ALWAYS);
+    f_write(&file->fp, &header, sizeof(header), &written);
+    for (uint32_t i = 0; i < data_length / sizeof(uint16_t); i++) {
+        uint16_t value = i + 1;
+        f_write(&file->fp, &value, sizeof(value), &written);
+    }
+    f_close(&file->fp);
+    f_open(&mock_disk_vfs.fatfs, &file->fp, path, FA_READ);
+    return file;
+}
+
+// Plays a wave file a channel at a time, as the samd DMA does for stereo, calling prefetch
+// between buffers when read_ahead is set like the background task would. Checks that every
+// buffer holds the next piece of the file, that get_buffer only reads from the file when
+// nothing was read ahead, and that read ahead never writes over the last three buffers given
+// out, which may still be playing. Returns the number of buffers played.
+STATIC uint32_t mock_wavefile_play(audioio_wavefile_obj_t *wavefile, bool read_ahead, bool *ok) {
+    const uint8_t *held[3] = {NULL, NULL, NULL};
+    uint32_t held_lengths[3] = {0, 0, 0};
+    uint8_t *held_copies = m_new(uint8_t, 3 * wavefile->len);
+    uint32_t buffers = 0;
+    uint16_t expected = 1;
+    audioio_wavefile_reset_buffer(wavefile, false, 0);
+    audioio_get_buffer_result_t result = GET_BUFFER_MORE_DATA;
+    while (result == GET_BUFFER_MORE_DATA) {
+        FSIZE_t position = f_tell(&wavefile->file->fp);
+        uint32_t underruns = common_hal_audioio_wavefile_get_underruns(wavefile);
+        uint8_t *left;
+        uint8_t *right;
+        uint32_t left_length;
+        uint32_t right_length;
+        result = audioio_wavefile_get_buffer(wavefile, wavefile->channel_count == 2, 0, &left, &left_length);
+        if (result == GET_BUFFER_ERROR) {
+            *ok = false;
+            break;
+        }
+        bool read = f_tell(&wavefile->file->fp) != position;
+        bool underrun = common_hal_audioio_wavefile_get_underruns(wavefile) != underruns;
+        *ok = *ok && (buffers < 2 || read == underrun);
+        if (wavefile->channel_count == 2) {
+            audioio_wavefile_get_buffer(wavefile, true, 1, &right, &right_length);
+            *ok = *ok && right == left + sizeof(uint16_t) && right_length == left_length;
+        }
+        for (uint32_t i = 0; i < left_length / sizeof(uint16_t); i++, expected++) {
+            uint16_t value = ((uint16_t*) left)[i];
+            // the last buffer is padded with silence to a whole word
+            *ok = *ok && (value == expected || (value == 0 && expected > wavefile->file_length / sizeof(uint16_t)));
+        }
+        held[buffers % 3] = left;
+        held_lengths[buffers % 3] = left_length;
+        buffers++;
+        if (!read_ahead) {
+            continue;
+        }
+        for (uint8_t i = 0; i < 3; i++) {
+            if (held[i] != NULL) {
+                memcpy(held_copies + i * wavefile->len, held[i], held_lengths[i]);
+            }
+        }
+        for (uint8_t i = 0; i < AUDIOIO_WAVEFILE_MAX_BUFFERS; i++) {
+            audioio_wavefile_prefetch(wavefile);
+        }
+        for (uint8_t i = 0; i < 3; i++) {
+            *ok = *ok && (held[i] == NULL || memcmp(held[i], held_copies + i * wavefile->len, held_lengths[i]) == 0);
+        }
+    }
+    *ok = *ok && result == GET_BUFFER_DONE;
+    m_del(uint8_t, held_copies, 3 * wavefile->len);
+    return buffers;
+}
+
+STATIC void mock_wavefile_check(const char *name, pyb_file_obj_t *file, uint8_t buffer_count, bool read_ahead, bool play_from_flash) {
+    audioio_wavefile_obj_t *wavefile = m_new_obj(audioio_wavefile_obj_t);
+    uint8_t *buffer = m_new(uint8_t, buffer_count * 128);
+    common_hal_audioio_wavefile_construct(wavefile, file, buffer, buffer_count * 128, buffer_count, play_from_flash);
+    bool ok = true;
+    // twice, to loop
+    uint32_t buffers = mock_wavefile_play(wavefile, read_ahead, &ok);
+    buffers += mock_wavefile_play(wavefile, read_ahead, &ok);
+    mp_printf(&mp_plat_print, "%s: %s, %u buffers, %u underruns, %s\n", name,
+        wavefile->fragments != NULL ? "from flash" : "buffered", (uint)buffers,
+        (uint)common_hal_audioio_wavefile_get_underruns(wavefile), ok ? "ok" : "bad");
+}
+
+// The bytes written to a SampleQueue, a sequence that doesn't repeat every 256 bytes so that
+// data played from the wrong place in the ring is caught.
+STATIC uint8_t mock_samplequeue_byte(uint32_t i) {
+    return i + i / 251;
+}
+
+// Writes `length` bytes to a SampleQueue while playing it a channel at a time, like
+// mock_wavefile_play, and then plays until silence has been handed out twice. Each write is
+// of a pseudo random size and is made after a buffer is handed out, so the ring is often full.
+// Checks that the data comes out in order across the end of the ring, that writes never
+// overwrite the last three buffers handed out, which may still be playing, and that silence
+// follows once the data runs out. Returns how many times playing wrapped around the ring.
+STATIC uint32_t mock_samplequeue_play(audioio_samplequeue_obj_t *queue, uint32_t length, bool *ok) {
+    uint32_t frame_size = queue->channel_count * queue->bits_per_sample / 8;
+    uint8_t silence = queue->bits_per_sample == 8 ? 0x80 : 0;
+    const uint8_t *silence_buffer = queue->buffer + queue->buffer_size;
+    const uint8_t *held[3] = {NULL, NULL, NULL};
+    uint32_t held_lengths[3] = {0, 0, 0};
+    uint8_t *held_copies = m_new(uint8_t, 3 * queue->len);
+    uint8_t *data = m_new(uint8_t, queue->buffer_size);
+    uint32_t seed = length;
+    uint32_t written = 0;
+    uint32_t played = 0;
+    uint32_t buffers = 0;
+    uint32_t silent_buffers = 0;
+    uint32_t wraps = 0;
+    const uint8_t *last = NULL;
+    while (silent_buffers < 2) {
+        uint8_t *left;
+        uint8_t *right;
+        uint32_t left_length;
+        uint32_t right_length;
+        audioio_samplequeue_get_buffer(queue, queue->channel_count == 2, 0, &left, &left_length);
+        if (queue->channel_count == 2) {
+            audioio_samplequeue_get_buffer(queue, true, 1, &right, &right_length);
+            *ok = *ok && right == left + queue->bits_per_sample / 8 && right_length == left_length;
+        }
+        if (left == silence_buffer) {
+            // Only the silence after the last write ends the play.
+            silent_buffers += written == length;
+            *ok = *ok && left_length == queue->len;
+            for (uint32_t i = 0; i < left_length; i++) {
+                *ok = *ok && left[i] == silence;
+            }
+        } else {
+            *ok = *ok && left >= queue->buffer && left + left_length <= silence_buffer &&
+                left_length % frame_size == 0 && left_length % sizeof(uint32_t) == 0;
+            for (uint32_t i = 0; i < left_length; i++, played++) {
+                *ok = *ok && left[i] == mock_samplequeue_byte(played);
+            }
+            wraps += last != NULL && left < last;
+            last = left;
+        }
+        held[buffers % 3] = left;
+        held_lengths[buffers % 3] = left_length;
+        buffers++;
+
+        for (uint8_t i = 0; i < 3; i++) {
+            if (held[i] != NULL) {
+                memcpy(held_copies + i * queue->len, held[i], held_lengths[i]);
+            }
+        }
+        seed = seed * 1103515245 + 12345;
+        uint32_t size = MIN((seed >> 16) % queue->buffer_size, length - written);
+        for (uint32_t i = 0; i < size; i++) {
+            data[i] = mock_samplequeue_byte(written + i);
+        }
+        uint32_t accepted = common_hal_audioio_samplequeue_write(queue, data, size);
+        written += accepted;
+        // Only whole frames are taken and one word of the ring is always left empty.
+        *ok = *ok && accepted % frame_size == 0 &&
+            common_hal_audioio_samplequeue_get_level(queue) <= queue->buffer_size - sizeof(uint32_t);
+        for (uint8_t i = 0; i < 3; i++) {
+            *ok = *ok && (held[i] == NULL || memcmp(held[i], held_copies + i * queue->len, held_lengths[i]) == 0);
+        }
+    }
+    *ok = *ok && played == length;
+    m_del(uint8_t, data, queue->buffer_size);
+    m_del(uint8_t, held_copies, 3 * queue->len);
+    return wraps;
+}
+
+STATIC void mock_samplequeue_check(const char *name, uint8_t bits_per_sample, uint8_t channel_count) {
+    audioio_samplequeue_obj_t *queue = m_new_obj(audioio_samplequeue_obj_t);
+    common_hal_audioio_samplequeue_construct(queue, 1000, bits_per_sample, channel_count, 22050);
+    bool ok = true;
+    audioio_samplequeue_reset_buffer(queue, false, 0);
+    // twice, to run out of data and start again
+    uint32_t wraps = mock_samplequeue_play(queue, 20000, &ok);
+    wraps += mock_samplequeue_play(queue, 7000, &ok);
+    mp_printf(&mp_plat_print, "%s: %u wraps, %u underruns, %s\n", name, (uint)wraps,
+        (uint)common_hal_audioio_samplequeue_get_underruns(queue), ok ? "ok" : "bad");
+}
+
+#define MOCK_FRAME_WIDTH (320)
+#define MOCK_FRAME_HEIGHT (240)
+// Rows rendered at a time, as a display refresh does into its stack buffer.
+#define MOCK_FRAME_BAND (16)
+
+STATIC const displayio_buffer_transform_t mock_frame_transform = {
+    .dx = 1, .dy = 1, .scale = 1, .width = MOCK_FRAME_WIDTH, .height = MOCK_FRAME_HEIGHT,
+};
+
+STATIC const _displayio_colorspace_t mock_rgb565 = {
+    .depth = 16, .bytes_per_cell = 2, .reverse_bytes_in_word = true,
+};
+
+// Makes a TileGrid of 16x16 tiles covering the frame, from a 64x64 Bitmap of random values shaded
+// by a Palette. Flipping it in x sends it down the per pixel path instead of the tile run one.
+STATIC displayio_tilegrid_t *mock_tilegrid_new(uint8_t bits_per_value, bool transparent, bool flip_x) {
+    uint32_t seed = bits_per_value;
+    displayio_bitmap_t *bitmap = m_new_obj(displayio_bitmap_t);
+    bitmap->base.type = &displayio_bitmap_type;
+    common_hal_displayio_bitmap_construct(bitmap, 64, 64, bits_per_value);
+    for (int16_t y = 0; y < 64; y++) {
+        for (int16_t x = 0; x < 64; x++) {
+            seed = seed * 1103515245 + 12345;
+            common_hal_displayio_bitmap_set_pixel(bitmap, x, y, (seed >> 16) & ((1 << bits_per_value) - 1));
+        }
+    }
+    displayio_palette_t *palette = m_new_obj(displayio_palette_t);
+    palette->base.type = &displayio_palette_type;
+    common_hal_displayio_palette_construct(palette, 1 << bits_per_value);
+    for (uint32_t i = 0; i < (1u << bits_per_value); i++) {
+        seed = seed * 1103515245 + 12345;
+        common_hal_displayio_palette_set_color(palette, i, seed >> 8);
+    }
+    if (transparent) {
+        common_hal_displayio_palette_make_transparent(palette, 0);
+    }
+    displayio_tilegrid_t *grid = m_new_obj(displayio_tilegrid_t);
+    grid->base.type = &displayio_tilegrid_type;
+    common_hal_displayio_tilegrid_construct(grid, bitmap, 4, 4, palette,
+        MOCK_FRAME_WIDTH / 16, MOCK_FRAME_HEIGHT / 16, 16, 16, 0, 0, 0);
+    for (uint16_t y = 0; y < MOCK_FRAME_HEIGHT / 16; y++) {
+        for (uint16_t x = 0; x < MOCK_FRAME_WIDTH / 16; x++) {
+            common_hal_displayio_tilegrid_set_tile(grid, x, y, (x * 7 + y * 3) % 16);
+        }
+    }
+    common_hal_displayio_tilegrid_set_flip_x(grid, flip_x);
+    displayio_tilegrid_update_transform(grid, &mock_frame_transform);
+    return grid;
+}
+
+// Renders the band of rows starting at y into a cleared buffer and mask.
+STATIC void mock_tilegrid_render_band(displayio_tilegrid_t *grid, int16_t y, uint16_t *buffer, uint32_t *mask) {
+    displayio_area_t area = {.x1 = 0, .y1 = y, .x2 = MOCK_FRAME_WIDTH, .y2 = y + MOCK_FRAME_BAND};
+    memset(buffer, 0, MOCK_FRAME_WIDTH * MOCK_FRAME_BAND * sizeof(uint16_t));
+    memset(mask, 0, MOCK_FRAME_WIDTH * MOCK_FRAME_BAND / 8);
+    bool filled_mask;
+    displayio_tilegrid_fill_area(grid, &mock_rgb565, &area, mask, (uint32_t*) buffer, &filled_mask);
+}
+
+// Checks that a TileGrid drawn a tile run at a time matches the same grid drawn pixel by pixel,
+// which is flipped so each row comes out reversed.
+STATIC void mock_tilegrid_compare(uint8_t bits_per_value, bool transparent) {
+    displayio_tilegrid_t *runs = mock_tilegrid_new(bits_per_value, transparent, false);
+    displayio_tilegrid_t *pixels = mock_tilegrid_new(bits_per_value, transparent, true);
+    uint16_t *runs_buffer = m_new(uint16_t, MOCK_FRAME_WIDTH * MOCK_FRAME_BAND);
+    uint16_t *pixels_buffer = m_new(uint16_t, MOCK_FRAME_WIDTH * MOCK_FRAME_BAND);
+    uint32_t *runs_mask = m_new(uint32_t, MOCK_FRAME_WIDTH * MOCK_FRAME_BAND / 32);
+    uint32_t *pixels_mask = m_new(uint32_t, MOCK_FRAME_WIDTH * MOCK_FRAME_BAND / 32);
+    bool same = true;
+    for (int16_t y = 0; y < MOCK_FRAME_HEIGHT; y += MOCK_FRAME_BAND) {
+        mock_tilegrid_render_band(runs, y, runs_buffer, runs_mask);
+        mock_tilegrid_render_band(pixels, y, pixels_buffer, pixels_mask);
+        for (uint32_t i = 0; i < MOCK_FRAME_WIDTH * MOCK_FRAME_BAND; i++) {
+            uint32_t j = i - i % MOCK_FRAME_WIDTH + MOCK_FRAME_WIDTH - 1 - i % MOCK_FRAME_WIDTH;
+            bool runs_set = (runs_mask[i / 32] & (1u << (i % 32))) != 0;
+            bool pixels_set = (pixels_mask[j / 32] & (1u << (j % 32))) != 0;
+            if (runs_buffer[i] != pixels_buffer[j] || runs_set != pixels_set) {
+                same = false;
+            }
+        }
+    }
+    mp_printf(&mp_plat_print, "%d bit %s: %s\n", bits_per_value, transparent ? "transparent" : "opaque",
+        same ? "ok" : "bad");
+}
+
+// Checks that a palette shown in two colorspaces keeps a table for each, and that changing a
+// color updates both.
+STATIC void mock_palette_colorspaces(void) {
+    static const _displayio_colorspace_t gray4 = {
+        .depth = 4, .bytes_per_cell = 1, .grayscale = true, .pixels_in_byte_share_row = true,
+    };
+    displayio_palette_t *palette = m_new_obj(displayio_palette_t);
+    palette->base.type = &displayio_palette_type;
+    common_hal_displayio_palette_construct(palette, 2);
+    common_hal_displayio_palette_set_color(palette, 0, 0xff0000);
+    common_hal_displayio_palette_set_color(palette, 1, 0xffffff);
+    const uint16_t *rgb565 = displayio_palette_get_converted_colors(palette, &mock_rgb565);
+    const uint16_t *gray = displayio_palette_get_converted_colors(palette, &gray4);
+    bool kept = rgb565 != gray &&
+        displayio_palette_get_converted_colors(palette, &mock_rgb565) == rgb565 &&
+        displayio_palette_get_converted_colors(palette, &gray4) == gray;
+    mp_printf(&mp_plat_print, "palette tables kept: %d, %04x %04x, %x %x\n", kept,
+        rgb565[0], rgb565[1], gray[0], gray[1]);
+    common_hal_displayio_palette_set_color(palette, 1, 0x0000ff);
+    rgb565 = displayio_palette_get_converted_colors(palette, &mock_rgb565);
+    gray = displayio_palette_get_converted_colors(palette, &gray4);
+    mp_printf(&mp_plat_print, "palette tables updated: %04x %x\n", rgb565[1], gray[1]);
+}
+
+// Prints how long a frame takes to draw a tile run at a time and pixel by pixel, which is how
+// every TileGrid used to be drawn.
+STATIC mp_obj_t tilegrid_benchmark(mp_obj_t frames_in) {
+    mp_int_t frames = mp_obj_get_int(frames_in);
+    uint16_t *buffer = m_new(uint16_t, MOCK_FRAME_WIDTH * MOCK_FRAME_BAND);
+    uint32_t *mask = m_new(uint32_t, MOCK_FRAME_WIDTH * MOCK_FRAME_BAND / 32);
+    for (uint8_t bits_per_value = 1; bits_per_value <= 8; bits_per_value *= 2) {
+        mp_uint_t us[2];
+        for (int flip_x = 0; flip_x < 2; flip_x++) {
+            displayio_tilegrid_t *grid = mock_tilegrid_new(bits_per_value, false, flip_x);
+            mp_uint_t start = mp_hal_ticks_us();
+            for (mp_int_t i = 0; i < frames; i++) {
+                for (int16_t y = 0; y < MOCK_FRAME_HEIGHT; y += MOCK_FRAME_BAND) {
+                    mock_tilegrid_render_band(grid, y, buffer, mask);
+                }
+            }
+            us[flip_x] = (mp_hal_ticks_us() - start) / frames;
+        }
+        mp_printf(&mp_plat_print, "%d bit: %u us per frame by tile runs, %u us by pixels\n",
+            bits_per_value, (uint)us[0], (uint)us[1]);
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(tilegrid_benchmark_obj, tilegrid_benchmark);
+
 // function to run extra tests for things that can't be checked by scripts
 STATIC mp_obj_t extra_coverage(void) {
     // mp_printf (used by ports that don't have a native printf)
@@ -420,6 +1030,174 @@ STATIC mp_obj_t extra_coverage(void) {
         }
     }
 
+    {
+        mp_printf(&mp_plat_print, "# audiomixer conversion\n");
+
+        static const mock_audio_format_t u8_mono_11025 = {11025, 1, 8, false};
+        static const mock_audio_format_t s16_stereo_44100 = {44100, 2, 16, true};
+        static const mock_audio_format_t u16_mono_16000 = {16000, 1, 16, false};
+        static const mock_audio_format_t s16_stereo_22050 = {22050, 2, 16, true};
+        static const mock_audio_format_t s16_mono_22050 = {22050, 1, 16, true};
+        static const mock_audio_format_t u8_mono_22050 = {22050, 1, 8, false};
+
+        // upsampled, widened and spread to both channels
+        mock_mixer_play(&u8_mono_11025, &s16_stereo_22050, false, 600);
+        mock_mixer_play(&u8_mono_11025, &s16_stereo_22050, true, 600);
+
+        // downsampled and mixed down to one channel
+        mock_mixer_play(&s16_stereo_44100, &s16_mono_22050, false, 8);
+        mock_mixer_play(&s16_stereo_44100, &s16_mono_22050, true, 32);
+
+        // a rate that isn't a multiple, narrowed and made unsigned
+        mock_mixer_play(&u16_mono_16000, &u8_mono_22050, false, 512);
+        mock_mixer_play(&u16_mono_16000, &u8_mono_22050, true, 512);
+    }
+
+    {
+        mp_printf(&mp_plat_print, "# audiomixer effects\n");
+
+        static const mock_audio_format_t s16_stereo_22050 = {22050, 2, 16, true};
+        static const mock_audio_format_t u8_mono_22050 = {22050, 1, 8, false};
+        const uint32_t count = MOCK_EFFECTS_FRAMES * 2;
+        mock_sine_sample_t *sample = mock_sine_sample_new(&s16_stereo_22050, MOCK_EFFECTS_FRAMES);
+        int16_t *in = m_new(int16_t, count);
+        for (uint32_t i = 0; i < count; i++) {
+            in[i] = mock_audio_read(&s16_stereo_22050, sample->data, i);
+        }
+        double *expected = m_new(double, count);
+
+        audiomixer_effects_obj_t *effects = mock_effects_new(sample);
+        for (uint32_t i = 0; i < count; i++) {
+            expected[i] = in[i];
+        }
+        mock_effects_compare("passthrough", effects, expected, 0);
+
+        // the first buffer ramps down a little every frame
+        effects = mock_effects_new(sample);
+        common_hal_audiomixer_effects_set_gain(effects, 0.5);
+        uint32_t ramp_frames = effects->len / sizeof(uint32_t);
+        for (uint32_t i = 0; i < count; i++) {
+            double gain = i / 2 < ramp_frames ? 1 - 0.5 * (i / 2) / ramp_frames : 0.5;
+            expected[i] = in[i] * gain;
+        }
+        mock_effects_compare("gain", effects, expected, 1);
+
+        // 1kHz low pass; the model uses the same Q14 coefficients
+        effects = mock_effects_new(sample);
+        static const float low_pass[5] = {0.01681, 0.03362, 0.01681, -1.60109, 0.66834};
+        common_hal_audiomixer_effects_set_filter(effects, low_pass);
+        double q[5];
+        for (size_t i = 0; i < 5; i++) {
+            q[i] = (double) (int16_t) (low_pass[i] * (1 << 14)) / (1 << 14);
+        }
+        for (uint32_t i = 0; i < count; i++) {
+            double x1 = i >= 2 ? in[i - 2] : 0;
+            double x2 = i >= 4 ? in[i - 4] : 0;
+            double y1 = i >= 2 ? expected[i - 2] : 0;
+            double y2 = i >= 4 ? expected[i - 4] : 0;
+            expected[i] = q[0] * in[i] + q[1] * x1 + q[2] * x2 - q[3] * y1 - q[4] * y2;
+        }
+        mock_effects_compare("filter", effects, expected, 24);
+
+        // 100 frames at half feedback and half mix, saturating like the stage does
+        effects = mock_effects_new(sample);
+        common_hal_audiomixer_effects_set_delay(effects, 100);
+        common_hal_audiomixer_effects_set_feedback(effects, 0.5);
+        common_hal_audiomixer_effects_set_mix(effects, 0.5);
+        double *line = m_new(double, 200);
+        for (uint32_t i = 0; i < 200; i++) {
+            line[i] = 0;
+        }
+        for (uint32_t i = 0; i < count; i++) {
+            double delayed = line[i % 200];
+            expected[i] = in[i] + 0.5 * delayed;
+            line[i % 200] = MIN(MAX(in[i] + 0.5 * delayed, INT16_MIN), INT16_MAX);
+        }
+        mock_effects_compare("delay", effects, expected, 2);
+
+        // samples above half scale are compressed towards full scale
+        effects = mock_effects_new(sample);
+        common_hal_audiomixer_effects_set_limit(effects, 0.5);
+        double threshold = effects->limit;
+        double headroom = INT16_MAX - threshold;
+        for (uint32_t i = 0; i < count; i++) {
+            double magnitude = abs(in[i]);
+            if (magnitude > threshold) {
+                double over = magnitude - threshold;
+                magnitude = threshold + over * headroom / (headroom + over);
+            }
+            expected[i] = in[i] < 0 ? -magnitude : magnitude;
+        }
+        mock_effects_compare("limit", effects, expected, 1);
+
+        // each channel read on its own gets the same buffer
+        effects = mock_effects_new(sample);
+        bool same = true;
+        uint32_t frame = 0;
+        audioio_get_buffer_result_t result = GET_BUFFER_MORE_DATA;
+        while (result == GET_BUFFER_MORE_DATA) {
+            uint8_t *left;
+            uint8_t *right;
+            uint32_t left_length;
+            uint32_t right_length;
+            result = audiomixer_effects_get_buffer(effects, true, 0, &left, &left_length);
+            audiomixer_effects_get_buffer(effects, true, 1, &right, &right_length);
+            same = same && right == left + sizeof(int16_t) && right_length == left_length;
+            for (uint32_t i = 0; i < left_length / sizeof(uint32_t); i++, frame++) {
+                same = same && ((int16_t*) left)[2 * i] == in[2 * frame] && ((int16_t*) right)[2 * i] == in[2 * frame + 1];
+            }
+        }
+        mp_printf(&mp_plat_print, "effects single channel: %s\n", same && frame == MOCK_EFFECTS_FRAMES ? "ok" : "bad");
+
+        // an odd number of 8 bit mono samples is widened and the last word padded
+        sample = mock_sine_sample_new(&u8_mono_22050, MOCK_EFFECTS_FRAMES);
+        effects = mock_effects_new(sample);
+        int16_t *out = m_new(int16_t, MOCK_EFFECTS_FRAMES + 1);
+        uint32_t mono_count = mock_effects_read(effects, out, MOCK_EFFECTS_FRAMES + 1);
+        same = mono_count == MOCK_EFFECTS_FRAMES;
+        for (uint32_t i = 0; i < mono_count; i++) {
+            same = same && out[i] == mock_audio_read(&u8_mono_22050, sample->data, i);
+        }
+        mp_printf(&mp_plat_print, "effects 8 bit mono: %s\n", same ? "ok" : "bad");
+    }
+
+    {
+        mp_printf(&mp_plat_print, "# audiocore wavefile\n");
+        mock_disk_init();
+
+        // 12 buffers and a last one that doesn't fill a word
+        pyb_file_obj_t *mono = mock_wavefile_open("/mono.wav", 1, 12 * 128 + 38);
+        mock_wavefile_check("mono, 4 buffers", mono, 4, true, false);
+        mock_wavefile_check("mono, 8 buffers", mono, 8, true, false);
+        // two buffers are one playing and one loading so nothing is read ahead
+        mock_wavefile_check("mono, 2 buffers", mono, 2, true, false);
+        mock_wavefile_check("mono, no background task", mono, 4, false, false);
+        // the last partial word is dropped
+        mock_wavefile_check("mono, play_from_flash", mono, 4, true, true);
+
+        pyb_file_obj_t *stereo = mock_wavefile_open("/stereo.wav", 2, 10 * 128);
+        mock_wavefile_check("stereo, 4 buffers", stereo, 4, true, false);
+        mock_wavefile_check("stereo, 3 buffers", stereo, 3, true, false);
+        mock_wavefile_check("stereo, play_from_flash", stereo, 4, true, true);
+    }
+
+    {
+        mp_printf(&mp_plat_print, "# audiocore samplequeue\n");
+        mock_samplequeue_check("16 bit mono", 16, 1);
+        mock_samplequeue_check("16 bit stereo", 16, 2);
+        mock_samplequeue_check("8 bit mono", 8, 1);
+        mock_samplequeue_check("8 bit stereo", 8, 2);
+    }
+
+    {
+        mp_printf(&mp_plat_print, "# displayio tilegrid\n");
+        for (uint8_t bits_per_value = 1; bits_per_value <= 8; bits_per_value *= 2) {
+            mock_tilegrid_compare(bits_per_value, false);
+            mock_tilegrid_compare(bits_per_value, true);
+        }
+        mock_palette_colorspaces();
+    }
+
     mp_obj_streamtest_t *s = m_new_obj(mp_obj_streamtest_t);
     s->base.type = &mp_type_stest_fileio;
     s->buf = NULL;
@@ -520,6 +520,8 @@ MP_NOINLINE int main_(int argc, char **argv) {
     {
         MP_DECLARE_CONST_FUN_OBJ_0(extra_coverage_obj);
         mp_store_global(QSTR_FROM_STR_STATIC("extra_coverage"), MP_OBJ_FROM_PTR(&extra_coverage_obj));
+        MP_DECLARE_CONST_FUN_OBJ_1(tilegrid_benchmark_obj);
+        mp_store_global(QSTR_FROM_STR_STATIC("tilegrid_benchmark"), MP_OBJ_FROM_PTR(&tilegrid_benchmark_obj));
     }
     #endif
 
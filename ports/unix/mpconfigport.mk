@@ -37,6 +37,9 @@ MICROPY_SSL_MBEDTLS = 0
 # jni module requires JVM/JNI
 MICROPY_PY_JNI = 0
 
+# uprofile module, with the VM counting opcodes and function calls
+MICROPY_VM_PROFILE = 0
+
 # Avoid using system libraries, use copies bundled with MicroPython
 # as submodules (currently affects only libffi).
 MICROPY_STANDALONE = 0
@@ -50,6 +50,12 @@
 #define MICROPY_FATFS_USE_LABEL        (1)
 #define MICROPY_PY_FRAMEBUF            (1)
 #define MICROPY_PY_COLLECTIONS_NAMEDTUPLE__ASDICT (1)
+#define MICROPY_GC_PROFILE             (1)
+#define MICROPY_GC_COMPACT             (1)
+#define MICROPY_VM_PROFILE             (1)
+
+// Block size of the RAM disk coverage.c plays WaveFiles from
+#define FILESYSTEM_BLOCK_SIZE          (512)
 
 // TODO these should be generic, not bound to fatfs
 #define mp_type_fileio mp_type_vfs_posix_fileio
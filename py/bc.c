@@ -294,13 +294,65 @@ continue2:;
     dump_args(code_state->state, n_state);
 }
 
+size_t mp_bytecode_get_source_line(const byte *bytecode, const byte *ip_in, qstr *block_name, qstr *source_file) {
+    const byte *ip = bytecode;
+    ip = mp_decode_uint_skip(ip); // skip n_state
+    ip = mp_decode_uint_skip(ip); // skip n_exc_stack
+    ip++; // skip scope_params
+    ip++; // skip n_pos_args
+    ip++; // skip n_kwonly_args
+    ip++; // skip n_def_pos_args
+    size_t bc = ip_in - ip;
+    size_t code_info_size = mp_decode_uint_value(ip);
+    ip = mp_decode_uint_skip(ip); // skip code_info_size
+    bc -= code_info_size;
+    #if MICROPY_PERSISTENT_CODE
+    *block_name = ip[0] | (ip[1] << 8);
+    *source_file = ip[2] | (ip[3] << 8);
+    ip += 4;
+    #else
+    *block_name = mp_decode_uint_value(ip);
+    ip = mp_decode_uint_skip(ip);
+    *source_file = mp_decode_uint_value(ip);
+    ip = mp_decode_uint_skip(ip);
+    #endif
+    size_t source_line = 1;
+    size_t c;
+    while ((c = *ip)) {
+        size_t b, l;
+        if ((c & 0x80) == 0) {
+            // 0b0LLBBBBB encoding
+            b = c & 0x1f;
+            l = c >> 5;
+            ip += 1;
+        } else {
+            // 0b1LLLBBBB 0bLLLLLLLL encoding (l's LSB in second byte)
+            b = c & 0xf;
+            l = ((c << 4) & 0x700) | ip[1];
+            ip += 2;
+        }
+        if (bc >= b) {
+            bc -= b;
+            source_line += l;
+        } else {
+            // found source line corresponding to bytecode offset
+            break;
+        }
+    }
+    return source_line;
+}
+
 #if MICROPY_PERSISTENT_CODE_LOAD || MICROPY_PERSISTENT_CODE_SAVE
 
 // The following table encodes the number of bytes that a specific opcode
-// takes up.  There are 3 special opcodes that always have an extra byte:
+// takes up.  There are 4 special opcodes that always have an extra byte:
 //     MP_BC_MAKE_CLOSURE
 //     MP_BC_MAKE_CLOSURE_DEFARGS
 //     MP_BC_RAISE_VARARGS
+//     MP_BC_FOR_RANGE
+// There are 2 special opcodes that always have 2 extra bytes:
+//     MP_BC_LOAD_FAST_FAST_BINARY_OP
+//     MP_BC_LOAD_FAST_CONST_BINARY_OP
 // There are 4 special opcodes that have an extra byte only when
 // MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE is enabled:
 //     MP_BC_LOAD_NAME
@@ -332,7 +384,7 @@ STATIC const byte opcode_format_table[64] = {
     OC4(U, O, B, O), // 0x3c-0x3f
     OC4(O, B, B, O), // 0x40-0x43
     OC4(B, B, O, B), // 0x44-0x47
-    OC4(U, U, U, U), // 0x48-0x4b
+    OC4(B, B, O, U), // 0x48-0x4b
     OC4(U, U, U, U), // 0x4c-0x4f
     OC4(V, V, U, V), // 0x50-0x53
     OC4(B, U, V, V), // 0x54-0x57
@@ -402,6 +454,7 @@ uint mp_opcode_format(const byte *ip, size_t *opcode_size) {
             *ip == MP_BC_RAISE_VARARGS
             || *ip == MP_BC_MAKE_CLOSURE
             || *ip == MP_BC_MAKE_CLOSURE_DEFARGS
+            || *ip == MP_BC_FOR_RANGE
             #if MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE
             || *ip == MP_BC_LOAD_NAME
             || *ip == MP_BC_LOAD_GLOBAL
@@ -409,6 +462,9 @@ uint mp_opcode_format(const byte *ip, size_t *opcode_size) {
             || *ip == MP_BC_STORE_ATTR
             #endif
         );
+        if (*ip == MP_BC_LOAD_FAST_FAST_BINARY_OP || *ip == MP_BC_LOAD_FAST_CONST_BINARY_OP) {
+            extra_byte = 2;
+        }
         ip += 1;
         if (f == MP_OPCODE_VAR_UINT) {
             while ((*ip++ & 0x80) != 0) {
@@ -81,6 +81,11 @@
 #define MP_BC_POP_EXCEPT         (0x45)
 #define MP_BC_UNWIND_JUMP        (0x46) // rel byte code offset, 16-bit signed, in excess; then a byte
 #define MP_BC_GET_ITER_STACK     (0x47)
+#define MP_BC_FOR_RANGE          (0x4a) // rel byte code offset, 16-bit unsigned; then a signed byte step
+
+// Fused LOAD_FAST, LOAD_FAST or LOAD_CONST_SMALL_INT, BINARY_OP sequences.
+#define MP_BC_LOAD_FAST_FAST_BINARY_OP  (0x48) // byte: local | local << 4; byte: op
+#define MP_BC_LOAD_FAST_CONST_BINARY_OP (0x49) // 16-bit: local | (small int + 16) << 4 | op << 10
 
 #define MP_BC_BUILD_TUPLE        (0x50) // uint
 #define MP_BC_BUILD_LIST         (0x51) // uint
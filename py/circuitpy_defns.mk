@@ -344,8 +344,10 @@ SRC_SHARED_MODULE_ALL = \
 	audioio/__init__.c \
 	audiocore/__init__.c \
 	audiocore/RawSample.c \
+	audiocore/SampleQueue.c \
 	audiocore/WaveFile.c \
 	audiomixer/__init__.c \
+	audiomixer/Effects.c \
 	audiomixer/Mixer.c \
 	audiomixer/MixerVoice.c \
 	audiomp3/__init__.c \
@@ -445,6 +447,7 @@ endif
 # All possible sources are listed here, and are filtered by SRC_PATTERNS.
 SRC_SHARED_MODULE_INTERNAL = \
 $(filter $(SRC_PATTERNS), \
+	displayio/area.c \
 	displayio/display_core.c \
 )
 
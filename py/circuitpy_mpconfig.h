@@ -152,6 +152,10 @@
 // Track stack usage. Expose results via ustack module.
 #define MICROPY_MAX_STACK_USAGE       (0)
 
+// Count opcodes and function calls in the VM. Expose results via uprofile module.
+#define MICROPY_VM_PROFILE            (CIRCUITPY_UPROFILE)
+#define MICROPY_VM_PROFILE_TICKS_US() supervisor_ticks_us32()
+
 // This port is intended to be 32-bit, but unfortunately, int32_t for
 // different targets may be defined in different ways - either as int
 // or as long. This requires different printf formatting specifiers
@@ -63,6 +63,10 @@ CFLAGS += -DCIRCUITPY_AUDIOCORE=$(CIRCUITPY_AUDIOCORE)
 CIRCUITPY_AUDIOMIXER ?= $(CIRCUITPY_AUDIOIO)
 CFLAGS += -DCIRCUITPY_AUDIOMIXER=$(CIRCUITPY_AUDIOMIXER)
 
+# Adds audiomixer.Effects.benchmark(), which counts cycles with the Cortex-M DWT.
+CIRCUITPY_AUDIOMIXER_BENCHMARK ?= 0
+CFLAGS += -DCIRCUITPY_AUDIOMIXER_BENCHMARK=$(CIRCUITPY_AUDIOMIXER_BENCHMARK)
+
 ifndef CIRCUITPY_AUDIOMP3
 ifeq ($(CIRCUITPY_FULL_BUILD),1)
 CIRCUITPY_AUDIOMP3 = $(CIRCUITPY_AUDIOCORE)
@@ -203,6 +207,10 @@ CFLAGS += -DCIRCUITPY_PEW=$(CIRCUITPY_PEW)
 CIRCUITPY_USTACK ?= 0
 CFLAGS += -DCIRCUITPY_USTACK=$(CIRCUITPY_USTACK)
 
+# For profiling. Slows down the VM.
+CIRCUITPY_UPROFILE ?= 0
+CFLAGS += -DCIRCUITPY_UPROFILE=$(CIRCUITPY_UPROFILE)
+
 # Non-module conditionals
 
 CIRCUITPY_BITBANG_APA102 ?= 0
@@ -1339,6 +1339,51 @@ STATIC void compile_while_stmt(compiler_t *comp, mp_parse_node_struct_t *pns) {
     EMIT_ARG(label_assign, break_label);
 }
 
+// This function compiles a for-loop over a range, as below, for bytecode.
+// The stack during the loop contains <end> then the next value of <var>.
+// The FOR_RANGE opcode compares the next value against <end>, pushes it
+// for storing to <var> and adds <step> to it.
+STATIC void compile_for_stmt_for_range(compiler_t *comp, mp_parse_node_t pn_var, mp_parse_node_t pn_start, mp_parse_node_t pn_end, mp_int_t step, mp_parse_node_t pn_body, mp_parse_node_t pn_else) {
+    START_BREAK_CONTINUE_BLOCK
+
+    uint pop_label = comp_next_label(comp);
+
+    compile_node(comp, pn_end);
+    compile_node(comp, pn_start);
+
+    EMIT_ARG(label_assign, continue_label);
+    EMIT_ARG(for_range, pop_label, step);
+    c_assign(comp, pn_var, ASSIGN_STORE);
+    compile_node(comp, pn_body);
+    if (!EMIT(last_emit_was_return_value)) {
+        EMIT_ARG(jump, continue_label);
+    }
+    EMIT_ARG(label_assign, pop_label);
+
+    // break/continue apply to outer loop (if any) in the else block
+    END_BREAK_CONTINUE_BLOCK
+
+    // Compile the else block.  We must pop <end> and the next value before
+    // executing the else code because it may contain break/continue statements.
+    uint end_label = 0;
+    if (!MP_PARSE_NODE_IS_NULL(pn_else)) {
+        EMIT(pop_top);
+        EMIT(pop_top);
+        compile_node(comp, pn_else);
+        end_label = comp_next_label(comp);
+        EMIT_ARG(jump, end_label);
+        EMIT_ARG(adjust_stack_size, 2);
+    }
+
+    EMIT_ARG(label_assign, break_label);
+    EMIT(pop_top);
+    EMIT(pop_top);
+
+    if (!MP_PARSE_NODE_IS_NULL(pn_else)) {
+        EMIT_ARG(label_assign, end_label);
+    }
+}
+
 // This function compiles an optimised for-loop of the form:
 //      for <var> in range(<start>, <end>, <step>):
 //          <body>
@@ -1356,6 +1401,18 @@ STATIC void compile_while_stmt(compiler_t *comp, mp_parse_node_struct_t *pns) {
 // the current value of <var>.  Otherwise, the stack contains <end> then the
 // current value of <var>.
 STATIC void compile_for_stmt_optimised_range(compiler_t *comp, mp_parse_node_t pn_var, mp_parse_node_t pn_start, mp_parse_node_t pn_end, mp_parse_node_t pn_step, mp_parse_node_t pn_body, mp_parse_node_t pn_else) {
+    assert(MP_PARSE_NODE_IS_SMALL_INT(pn_step));
+    mp_int_t step = MP_PARSE_NODE_LEAF_SMALL_INT(pn_step);
+    if (-128 <= step && step <= 127
+        #if MICROPY_EMIT_NATIVE
+        && comp->scope_cur->emit_options != MP_EMIT_OPT_NATIVE_PYTHON
+        && comp->scope_cur->emit_options != MP_EMIT_OPT_VIPER
+        #endif
+        ) {
+        compile_for_stmt_for_range(comp, pn_var, pn_start, pn_end, step, pn_body, pn_else);
+        return;
+    }
+
     START_BREAK_CONTINUE_BLOCK
 
     uint top_label = comp_next_label(comp);
@@ -1439,7 +1496,7 @@ STATIC void compile_for_stmt_optimised_range(compiler_t *comp, mp_parse_node_t p
 
 STATIC void compile_for_stmt(compiler_t *comp, mp_parse_node_struct_t *pns) {
     // this bit optimises: for <x> in range(...), turning it into an explicitly incremented variable
-    // this is actually slower, but uses no heap memory
+    // this uses no heap memory, and for bytecode the FOR_RANGE opcode makes it faster too
     // for viper it will be much, much faster
     if (/*comp->scope_cur->emit_options == MP_EMIT_OPT_VIPER &&*/ MP_PARSE_NODE_IS_ID(pns->nodes[0]) && MP_PARSE_NODE_IS_STRUCT_KIND(pns->nodes[1], PN_atom_expr_normal)) {
         mp_parse_node_struct_t *pns_it = (mp_parse_node_struct_t*)pns->nodes[1];
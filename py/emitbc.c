@@ -64,6 +64,14 @@ struct _emit_t {
     size_t bytecode_size;
     byte *code_base; // stores both byte code and code info
 
+    // The last one or two loads of a local or small int that a following
+    // binary op can be fused with, and where they start in the bytecode.
+    // They are only next to the binary op if fuse_end is where it starts.
+    size_t fuse_offset[2];
+    size_t fuse_end;
+    uint16_t fuse_load[2]; // local number, or small int + 16 | FUSE_CONST
+    byte fuse_n;
+
     #if MICROPY_PERSISTENT_CODE
     uint16_t ct_cur_obj;
     uint16_t ct_num_obj;
@@ -168,6 +176,26 @@ STATIC void emit_write_code_info_bytes_lines(emit_t *emit, mp_uint_t bytes_to_sk
 }
 #endif
 
+#define FUSE_CONST (0x100)
+
+// Record a load that was just emitted starting at offset, if it can be fused
+// with a binary op.
+STATIC void emit_fuse_load(emit_t *emit, size_t offset, uint16_t load) {
+    if (emit->fuse_n > 0 && emit->fuse_end != offset) {
+        // something else was emitted since the last load
+        emit->fuse_n = 0;
+    }
+    if (emit->fuse_n == 2) {
+        emit->fuse_offset[0] = emit->fuse_offset[1];
+        emit->fuse_load[0] = emit->fuse_load[1];
+        emit->fuse_n = 1;
+    }
+    emit->fuse_offset[emit->fuse_n] = offset;
+    emit->fuse_load[emit->fuse_n] = load;
+    emit->fuse_n += 1;
+    emit->fuse_end = emit->bytecode_offset;
+}
+
 // all functions must go through this one to emit byte code
 STATIC byte *emit_get_cur_to_write_bytecode(emit_t *emit, int num_bytes_to_write) {
     //printf("emit %d\n", num_bytes_to_write);
@@ -321,6 +349,7 @@ void mp_emit_bc_start_pass(emit_t *emit, pass_kind_t pass, scope_t *scope) {
     #endif
     emit->bytecode_offset = 0;
     emit->code_info_offset = 0;
+    emit->fuse_n = 0;
 
     // Write local state size and exception stack size.
     {
@@ -470,6 +499,8 @@ static inline void emit_bc_pre(emit_t *emit, mp_int_t stack_size_delta) {
 
 void mp_emit_bc_set_source_line(emit_t *emit, mp_uint_t source_line) {
     //printf("source: line %d -> %d  offset %d -> %d\n", emit->last_source_line, source_line, emit->last_source_line_offset, emit->bytecode_offset);
+    // a new line must start at its own opcode
+    emit->fuse_n = 0;
 #if MICROPY_ENABLE_SOURCE_LINE
     if (MP_STATE_VM(mp_optimise_value) >= 3) {
         // If we compile with -O3, don't store line numbers.
@@ -490,6 +521,8 @@ void mp_emit_bc_set_source_line(emit_t *emit, mp_uint_t source_line) {
 
 void mp_emit_bc_label_assign(emit_t *emit, mp_uint_t l) {
     emit_bc_pre(emit, 0);
+    // a jump to the label must not land inside a fused opcode
+    emit->fuse_n = 0;
     if (emit->pass == MP_PASS_SCOPE) {
         return;
     }
@@ -535,7 +568,9 @@ void mp_emit_bc_load_const_tok(emit_t *emit, mp_token_kind_t tok) {
 void mp_emit_bc_load_const_small_int(emit_t *emit, mp_int_t arg) {
     emit_bc_pre(emit, 1);
     if (-16 <= arg && arg <= 47) {
+        size_t offset = emit->bytecode_offset;
         emit_write_bytecode_byte(emit, MP_BC_LOAD_CONST_SMALL_INT_MULTI + 16 + arg);
+        emit_fuse_load(emit, offset, FUSE_CONST | (16 + arg));
     } else {
         emit_write_bytecode_byte_int(emit, MP_BC_LOAD_CONST_SMALL_INT, arg);
     }
@@ -562,7 +597,9 @@ void mp_emit_bc_load_local(emit_t *emit, qstr qst, mp_uint_t local_num, int kind
     (void)qst;
     emit_bc_pre(emit, 1);
     if (kind == MP_EMIT_IDOP_LOCAL_FAST && local_num <= 15) {
+        size_t offset = emit->bytecode_offset;
         emit_write_bytecode_byte(emit, MP_BC_LOAD_FAST_MULTI + local_num);
+        emit_fuse_load(emit, offset, local_num);
     } else {
         emit_write_bytecode_byte_uint(emit, MP_BC_LOAD_FAST_N + kind, local_num);
     }
@@ -761,6 +798,13 @@ void mp_emit_bc_for_iter_end(emit_t *emit) {
     emit_bc_pre(emit, -MP_OBJ_ITER_BUF_NSLOTS);
 }
 
+void mp_emit_bc_for_range(emit_t *emit, mp_uint_t label, mp_int_t step) {
+    assert(-128 <= step && step <= 127 && step != 0);
+    emit_bc_pre(emit, 1);
+    emit_write_bytecode_byte_unsigned_label(emit, MP_BC_FOR_RANGE, label);
+    emit_write_bytecode_byte(emit, step);
+}
+
 void mp_emit_bc_pop_block(emit_t *emit) {
     emit_bc_pre(emit, 0);
     emit_write_bytecode_byte(emit, MP_BC_POP_BLOCK);
@@ -786,7 +830,27 @@ void mp_emit_bc_binary_op(emit_t *emit, mp_binary_op_t op) {
         op = MP_BINARY_OP_IS;
     }
     emit_bc_pre(emit, -1);
-    emit_write_bytecode_byte(emit, MP_BC_BINARY_OP_MULTI + op);
+    if (emit->fuse_n == 2 && emit->fuse_end == emit->bytecode_offset
+        && !(emit->fuse_load[0] & FUSE_CONST)) {
+        // Replace the two loads with a single opcode, of the same size, that
+        // does them along with the binary op.
+        MP_STATIC_ASSERT(MP_BINARY_OP_NUM_BYTECODE <= 64);
+        emit->bytecode_offset = emit->fuse_offset[0];
+        byte *c = emit_get_cur_to_write_bytecode(emit, 3);
+        if (emit->fuse_load[1] & FUSE_CONST) {
+            uint16_t arg = emit->fuse_load[0] | (emit->fuse_load[1] & 0x3f) << 4 | op << 10;
+            c[0] = MP_BC_LOAD_FAST_CONST_BINARY_OP;
+            c[1] = arg;
+            c[2] = arg >> 8;
+        } else {
+            c[0] = MP_BC_LOAD_FAST_FAST_BINARY_OP;
+            c[1] = emit->fuse_load[0] | emit->fuse_load[1] << 4;
+            c[2] = op;
+        }
+        emit->fuse_n = 0;
+    } else {
+        emit_write_bytecode_byte(emit, MP_BC_BINARY_OP_MULTI + op);
+    }
     if (invert) {
         emit_bc_pre(emit, 0);
         emit_write_bytecode_byte(emit, MP_BC_UNARY_OP_MULTI + MP_UNARY_OP_NOT);
@@ -956,6 +1020,7 @@ const emit_method_table_t emit_bc_method_table = {
     mp_emit_bc_get_iter,
     mp_emit_bc_for_iter,
     mp_emit_bc_for_iter_end,
+    mp_emit_bc_for_range,
     mp_emit_bc_pop_block,
     mp_emit_bc_pop_except,
     mp_emit_bc_unary_op,
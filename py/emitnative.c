@@ -2282,6 +2282,7 @@ const emit_method_table_t EXPORT_FUN(method_table) = {
     emit_native_get_iter,
     emit_native_for_iter,
     emit_native_for_iter_end,
+    NULL, // for_range is never called when emitting native code
     emit_native_pop_block,
     emit_native_pop_except,
     emit_native_unary_op,
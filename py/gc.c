@@ -30,6 +30,14 @@
 
 #include "py/gc.h"
 #include "py/runtime.h"
+#if MICROPY_GC_COMPACT
+#include "py/objfun.h"
+#include "py/objstr.h"
+#endif
+#if MICROPY_GC_PROFILE
+#include "py/bc.h"
+#include "py/mphal.h"
+#endif
 
 #include "supervisor/shared/safe_mode.h"
 
@@ -74,6 +82,26 @@
 #define ATB_HEAD_TO_MARK(block) do { MP_STATE_MEM(gc_alloc_table_start)[(block) / BLOCKS_PER_ATB] |= (AT_MARK << BLOCK_SHIFT(block)); } while (0)
 #define ATB_MARK_TO_HEAD(block) do { MP_STATE_MEM(gc_alloc_table_start)[(block) / BLOCKS_PER_ATB] &= (~(AT_TAIL << BLOCK_SHIFT(block))); } while (0)
 
+#if defined(__GNUC__) && MP_ENDIANNESS_LITTLE
+// Scan the ATB a machine word at a time. On a little endian machine the
+// blocks in a word are in bit order, two bits each, so the states of the
+// whole word can be tested together.
+#define ATB_WORD_SCAN (1)
+#define BYTES_PER_ATB_WORD (sizeof(uintptr_t))
+#define BLOCKS_PER_ATB_WORD (BYTES_PER_ATB_WORD * BLOCKS_PER_ATB)
+// The low bit of each block's two bits is set if the block is in use.
+#define ATB_WORD_USED(word) (((word) | ((word) >> 1)) & ((uintptr_t)-1 / 3))
+#if UINTPTR_MAX == 0xffffffff
+#define ATB_WORD_CTZ(word) __builtin_ctz(word)
+#define ATB_WORD_CLZ(word) __builtin_clz(word)
+#else
+#define ATB_WORD_CTZ(word) __builtin_ctzll(word)
+#define ATB_WORD_CLZ(word) __builtin_clzll(word)
+#endif
+#else
+#define ATB_WORD_SCAN (0)
+#endif
+
 #define BLOCK_FROM_PTR(ptr) (((byte*)(ptr) - MP_STATE_MEM(gc_pool_start)) / BYTES_PER_BLOCK)
 #define PTR_FROM_BLOCK(block) (((block) * BYTES_PER_BLOCK + (uintptr_t)MP_STATE_MEM(gc_pool_start)))
 #define ATB_FROM_BLOCK(bl) ((bl) / BLOCKS_PER_ATB)
@@ -108,6 +136,57 @@ void __attribute__ ((noinline)) gc_log_change(uint32_t start_block, uint32_t len
 #pragma GCC pop_options
 #endif
 
+#if MICROPY_GC_FREE_LIST_LEN
+// Count the free blocks starting at block, up to the largest size class. Runs
+// are cut short at the long lived section so that short lived allocations
+// served from the free lists stay on their side of the heap.
+STATIC size_t gc_free_list_run_length(size_t block) {
+    size_t limit = BLOCK_FROM_PTR(MP_STATE_MEM(gc_lowest_long_lived_ptr));
+    size_t n_free = 0;
+    while (n_free < MICROPY_GC_FREE_LIST_CLASSES && block + n_free < limit &&
+           ATB_GET_KIND(block + n_free) == AT_FREE) {
+        n_free++;
+    }
+    return n_free;
+}
+
+STATIC void gc_free_list_push(size_t block, size_t n_free) {
+    size_t size_class = MIN(n_free, MICROPY_GC_FREE_LIST_CLASSES) - 1;
+    uint16_t count = MP_STATE_MEM(gc_free_list_count)[size_class];
+    if (count < MICROPY_GC_FREE_LIST_LEN) {
+        MP_STATE_MEM(gc_free_list)[size_class][count] = block;
+        MP_STATE_MEM(gc_free_list_count)[size_class] = count + 1;
+    }
+}
+
+// Find a run of n_blocks free blocks using the free lists, starting with the
+// exact size class and splitting larger runs. Returns the first block of the
+// run or 0xffffffff if none is known.
+STATIC size_t gc_free_list_take(size_t n_blocks) {
+    for (size_t size_class = n_blocks - 1; size_class < MICROPY_GC_FREE_LIST_CLASSES; size_class++) {
+        while (MP_STATE_MEM(gc_free_list_count)[size_class] > 0) {
+            size_t block = MP_STATE_MEM(gc_free_list)[size_class][--MP_STATE_MEM(gc_free_list_count)[size_class]];
+            // The ATB scan, realloc and long lived allocations don't update the
+            // lists so check that the run is still free.
+            size_t n_free = gc_free_list_run_length(block);
+            if (n_free >= n_blocks) {
+                size_t rest = gc_free_list_run_length(block + n_blocks);
+                if (rest > 0) {
+                    gc_free_list_push(block + n_blocks, rest);
+                }
+                return block;
+            }
+            // Too short now; file it under the size it has become. That class
+            // is smaller than any we are still going to search.
+            if (n_free > 0) {
+                gc_free_list_push(block, n_free);
+            }
+        }
+    }
+    return 0xffffffff;
+}
+#endif
+
 // TODO waste less memory; currently requires that all entries in alloc_table have a corresponding block in pool
 void gc_init(void *start, void *end) {
     // align end pointer on block boundary
@@ -157,6 +236,20 @@ void gc_init(void *start, void *end) {
     // Set last free ATB index to the end of the heap.
     MP_STATE_MEM(gc_last_free_atb_index) = MP_STATE_MEM(gc_alloc_table_byte_len) - 1;
 
+    #if MICROPY_GC_FREE_LIST_LEN
+    // The free lists are filled by the first sweep.
+    memset(MP_STATE_MEM(gc_free_list_count), 0, sizeof(MP_STATE_MEM(gc_free_list_count)));
+    #endif
+
+    #if MICROPY_GC_COMPACT
+    MP_STATE_MEM(gc_compact_table) = NULL;
+    MP_STATE_MEM(gc_compacting) = false;
+    #endif
+
+    #if MICROPY_GC_PROFILE
+    gc_profile_reset();
+    #endif
+
     // Set the lowest long lived ptr to the end of the heap to start. This will be lowered as long
     // lived objects are allocated.
     MP_STATE_MEM(gc_lowest_long_lived_ptr) = (void*) PTR_FROM_BLOCK(MP_STATE_MEM(gc_alloc_table_byte_len * BLOCKS_PER_ATB));
@@ -280,6 +373,14 @@ STATIC void gc_sweep(void) {
     #if MICROPY_PY_GC_COLLECT_RETVAL
     MP_STATE_MEM(gc_collected) = 0;
     #endif
+    #if MICROPY_GC_FREE_LIST_LEN
+    // Rebuild the free lists from the runs of free blocks the sweep leaves
+    // behind in the short lived section.
+    memset(MP_STATE_MEM(gc_free_list_count), 0, sizeof(MP_STATE_MEM(gc_free_list_count)));
+    size_t crossover_block = BLOCK_FROM_PTR(MP_STATE_MEM(gc_lowest_long_lived_ptr));
+    size_t run_start = 0;
+    size_t run_length = 0;
+    #endif
     // free unmarked heads and their tails
     int free_tail = 0;
     for (size_t block = 0; block < MP_STATE_MEM(gc_alloc_table_byte_len) * BLOCKS_PER_ATB; block++) {
@@ -336,8 +437,82 @@ STATIC void gc_sweep(void) {
                 free_tail = 0;
                 break;
         }
+        #if MICROPY_GC_FREE_LIST_LEN
+        if (block < crossover_block && ATB_GET_KIND(block) == AT_FREE) {
+            if (run_length++ == 0) {
+                run_start = block;
+            }
+        } else if (run_length > 0) {
+            gc_free_list_push(run_start, run_length);
+            run_length = 0;
+        }
+        #endif
+    }
+    #if MICROPY_GC_FREE_LIST_LEN
+    if (run_length > 0) {
+        gc_free_list_push(run_start, run_length);
+    }
+    // Runs were pushed from the bottom of the heap up. Reverse each list so
+    // the lowest runs are used first and the heap stays packed at the start.
+    for (size_t size_class = 0; size_class < MICROPY_GC_FREE_LIST_CLASSES; size_class++) {
+        size_t *list = MP_STATE_MEM(gc_free_list)[size_class];
+        for (size_t i = 0, j = MP_STATE_MEM(gc_free_list_count)[size_class]; i + 1 < j; i++, j--) {
+            size_t block = list[i];
+            list[i] = list[j - 1];
+            list[j - 1] = block;
+        }
+    }
+    #endif
+}
+
+#if MICROPY_GC_COMPACT
+// A field of a str, bytes, function, dict or qstr pool that points into a
+// chain in the long lived section. The table is sorted by chain and the last
+// entry for each chain holds its reference count.
+typedef struct _gc_compact_entry_t {
+    size_t block;
+    size_t n_blocks;
+    size_t slot; // word offset of the field from the start of the pool
+    size_t n_refs;
+} gc_compact_entry_t;
+
+#define GC_COMPACT_STALE ((size_t)-1)
+
+// Returns the last entry for the chain containing block, or NULL.
+STATIC gc_compact_entry_t *gc_compact_find(size_t block) {
+    gc_compact_entry_t *table = MP_STATE_MEM(gc_compact_table);
+    size_t lo = 0;
+    size_t hi = MP_STATE_MEM(gc_compact_len);
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (table[mid].block <= block) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo == 0 || block >= table[lo - 1].block + table[lo - 1].n_blocks) {
+        return NULL;
+    }
+    return &table[lo - 1];
+}
+
+// Count the words that point into a chain in the table, anywhere inside it.
+STATIC void gc_compact_count(void **ptrs, size_t len) {
+    if (MP_STATE_MEM(gc_compact_table) == NULL) {
+        return;
+    }
+    for (size_t i = 0; i < len; i++) {
+        byte *ptr = ptrs[i];
+        if (ptr >= (byte*)MP_STATE_MEM(gc_lowest_long_lived_ptr) && ptr < MP_STATE_MEM(gc_pool_end)) {
+            gc_compact_entry_t *entry = gc_compact_find(BLOCK_FROM_PTR(ptr));
+            if (entry != NULL) {
+                entry->n_refs++;
+            }
+        }
     }
 }
+#endif
 
 // Mark can handle NULL pointers because it verifies the pointer is within the heap bounds.
 STATIC void gc_mark(void* ptr) {
@@ -355,6 +530,9 @@ STATIC void gc_mark(void* ptr) {
 void gc_collect_start(void) {
     GC_ENTER();
     MP_STATE_MEM(gc_lock_depth)++;
+    #if MICROPY_GC_PROFILE
+    MP_STATE_MEM(gc_profile_collect_start) = MICROPY_GC_PROFILE_TICKS_US();
+    #endif
     #if MICROPY_GC_ALLOC_THRESHOLD
     MP_STATE_MEM(gc_alloc_amount) = 0;
     #endif
@@ -370,6 +548,10 @@ void gc_collect_start(void) {
 
     gc_mark(MP_STATE_MEM(permanent_pointers));
 
+    #if MICROPY_GC_COMPACT
+    gc_mark(MP_STATE_MEM(gc_compact_table));
+    #endif
+
     #if MICROPY_ENABLE_PYSTACK
     // Trace root pointers from the Python stack.
     ptrs = (void**)(void*)MP_STATE_THREAD(pystack_start);
@@ -378,10 +560,16 @@ void gc_collect_start(void) {
 }
 
 void gc_collect_ptr(void *ptr) {
+    #if MICROPY_GC_COMPACT
+    gc_compact_count(&ptr, 1);
+    #endif
     gc_mark(ptr);
 }
 
 void gc_collect_root(void **ptrs, size_t len) {
+    #if MICROPY_GC_COMPACT
+    gc_compact_count(ptrs, len);
+    #endif
     for (size_t i = 0; i < len; i++) {
         void *ptr = ptrs[i];
         gc_mark(ptr);
@@ -395,6 +583,14 @@ void gc_collect_end(void) {
         MP_STATE_MEM(gc_first_free_atb_index)[i] = 0;
     }
     MP_STATE_MEM(gc_last_free_atb_index) = MP_STATE_MEM(gc_alloc_table_byte_len) - 1;
+    #if MICROPY_GC_PROFILE
+    mp_uint_t pause = MICROPY_GC_PROFILE_TICKS_US() - MP_STATE_MEM(gc_profile_collect_start);
+    MP_STATE_MEM(gc_profile_collections)++;
+    MP_STATE_MEM(gc_profile_pause_total) += pause;
+    if (pause > MP_STATE_MEM(gc_profile_pause_max)) {
+        MP_STATE_MEM(gc_profile_pause_max) = pause;
+    }
+    #endif
     MP_STATE_MEM(gc_lock_depth)--;
     GC_EXIT();
 }
@@ -402,6 +598,9 @@ void gc_collect_end(void) {
 void gc_sweep_all(void) {
     GC_ENTER();
     MP_STATE_MEM(gc_lock_depth)++;
+    #if MICROPY_GC_PROFILE
+    MP_STATE_MEM(gc_profile_collect_start) = MICROPY_GC_PROFILE_TICKS_US();
+    #endif
     MP_STATE_MEM(gc_stack_overflow) = 0;
     gc_collect_end();
 }
@@ -474,9 +673,384 @@ bool gc_alloc_possible(void) {
     return MP_STATE_MEM(gc_pool_start) != 0;
 }
 
+#if ATB_WORD_SCAN
+// Returns a mask with the low bit of every block set where a run of n_blocks
+// free blocks starts and ends within the word.
+STATIC uintptr_t gc_atb_word_runs(uintptr_t used, size_t n_blocks) {
+    uintptr_t runs = ATB_WORD_USED(~(uintptr_t)0) & ~used;
+    for (size_t i = 1; runs != 0 && i < n_blocks; i++) {
+        runs &= ~used >> (2 * i);
+    }
+    return runs;
+}
+#endif
+
+// Look for a run of n_blocks free blocks from the start of ATB byte first_atb
+// up to the end of ATB byte last_atb. A block in use at or beyond stop_block
+// ends the search. Returns the last block of the run or 0xffffffff.
+STATIC size_t gc_find_free_run_up(size_t n_blocks, size_t first_atb, size_t last_atb, size_t stop_block) {
+    const byte *atb = MP_STATE_MEM(gc_alloc_table_start);
+    size_t n_free = 0;
+    for (size_t i = first_atb; i <= last_atb;) {
+        #if ATB_WORD_SCAN
+        if (((uintptr_t)(atb + i) & (BYTES_PER_ATB_WORD - 1)) == 0 && i + BYTES_PER_ATB_WORD - 1 <= last_atb) {
+            size_t block = i * BLOCKS_PER_ATB;
+            uintptr_t used = ATB_WORD_USED(*(const uintptr_t*)(const void*)(atb + i));
+            if (used == 0) {
+                if (n_free + BLOCKS_PER_ATB_WORD >= n_blocks) {
+                    return block + n_blocks - n_free - 1;
+                }
+                n_free += BLOCKS_PER_ATB_WORD;
+                i += BYTES_PER_ATB_WORD;
+                continue;
+            }
+            if (block + BLOCKS_PER_ATB_WORD <= stop_block) {
+                // the run carried over from below ends in this word
+                size_t n_low = ATB_WORD_CTZ(used) / 2;
+                if (n_free + n_low >= n_blocks) {
+                    return block + n_blocks - n_free - 1;
+                }
+                uintptr_t runs = gc_atb_word_runs(used, n_blocks);
+                if (runs != 0) {
+                    return block + ATB_WORD_CTZ(runs) / 2 + n_blocks - 1;
+                }
+                // the run at the top of the word carries over to the next
+                n_free = ATB_WORD_CLZ(used) / 2;
+                i += BYTES_PER_ATB_WORD;
+                continue;
+            }
+        }
+        #endif
+        // Four ATB states are packed into a single byte.
+        byte a = atb[i];
+        for (size_t j = 0; j < BLOCKS_PER_ATB; j++) {
+            size_t block = i * BLOCKS_PER_ATB + j;
+            if ((a & (0x3 << (j * 2))) == 0) {
+                if (++n_free >= n_blocks) {
+                    return block;
+                }
+            } else {
+                if (block >= stop_block) {
+                    return 0xffffffff;
+                }
+                n_free = 0;
+            }
+        }
+        i++;
+    }
+    return 0xffffffff;
+}
+
+// As gc_find_free_run_up but searching down from the end of ATB byte
+// last_atb, stopping at a block in use below stop_block. Returns the first
+// block of the run or 0xffffffff.
+STATIC size_t gc_find_free_run_down(size_t n_blocks, size_t first_atb, size_t last_atb, size_t stop_block) {
+    const byte *atb = MP_STATE_MEM(gc_alloc_table_start);
+    size_t n_free = 0;
+    // i is one past the next ATB byte to look at
+    for (size_t i = last_atb + 1; i > first_atb;) {
+        #if ATB_WORD_SCAN
+        if (((uintptr_t)(atb + i) & (BYTES_PER_ATB_WORD - 1)) == 0 && i - first_atb >= BYTES_PER_ATB_WORD) {
+            i -= BYTES_PER_ATB_WORD;
+            size_t block = i * BLOCKS_PER_ATB;
+            uintptr_t used = ATB_WORD_USED(*(const uintptr_t*)(const void*)(atb + i));
+            if (used == 0) {
+                if (n_free + BLOCKS_PER_ATB_WORD >= n_blocks) {
+                    return block + BLOCKS_PER_ATB_WORD - (n_blocks - n_free);
+                }
+                n_free += BLOCKS_PER_ATB_WORD;
+                continue;
+            }
+            if (block >= stop_block) {
+                // the run carried over from above ends in this word
+                size_t n_high = ATB_WORD_CLZ(used) / 2;
+                if (n_free + n_high >= n_blocks) {
+                    return block + BLOCKS_PER_ATB_WORD - (n_blocks - n_free);
+                }
+                uintptr_t runs = gc_atb_word_runs(used, n_blocks);
+                if (runs != 0) {
+                    // take the highest run, as a block by block search would
+                    return block + BLOCKS_PER_ATB_WORD - 1 - ATB_WORD_CLZ(runs) / 2;
+                }
+                // the run at the bottom of the word carries over to the next
+                n_free = ATB_WORD_CTZ(used) / 2;
+                continue;
+            }
+            i += BYTES_PER_ATB_WORD;
+        }
+        #endif
+        i--;
+        byte a = atb[i];
+        for (size_t j = BLOCKS_PER_ATB; j-- > 0;) {
+            size_t block = i * BLOCKS_PER_ATB + j;
+            if ((a & (0x3 << (j * 2))) == 0) {
+                if (++n_free >= n_blocks) {
+                    return block;
+                }
+            } else {
+                if (block < stop_block) {
+                    return 0xffffffff;
+                }
+                n_free = 0;
+            }
+        }
+    }
+    return 0xffffffff;
+}
+
+#if MICROPY_GC_COMPACT
+STATIC size_t gc_chain_length(size_t block) {
+    size_t total_blocks = MP_STATE_MEM(gc_alloc_table_byte_len) * BLOCKS_PER_ATB;
+    size_t n_blocks = 1;
+    while (block + n_blocks < total_blocks && ATB_GET_KIND(block + n_blocks) == AT_TAIL) {
+        n_blocks++;
+    }
+    return n_blocks;
+}
+
+STATIC void gc_compact_add(gc_compact_entry_t *table, size_t *len, size_t max_len, const void *slot) {
+    void *ptr = *(void *const *)slot;
+    // qstr pools point into the middle of the chunks holding the strings, so
+    // the pointer needn't be aligned to a block.
+    if (*len == max_len || ptr < MP_STATE_MEM(gc_lowest_long_lived_ptr) || ptr >= (void*)MP_STATE_MEM(gc_pool_end)) {
+        return;
+    }
+    size_t block = BLOCK_FROM_PTR(ptr);
+    while (ATB_GET_KIND(block) == AT_TAIL) {
+        block--;
+    }
+    if (ATB_GET_KIND(block) != AT_HEAD) {
+        return;
+    }
+    #if MICROPY_ENABLE_FINALISER
+    if (FTB_GET(block)) {
+        return;
+    }
+    #endif
+    table[*len].block = block;
+    table[*len].slot = ((const byte*)slot - MP_STATE_MEM(gc_pool_start)) / sizeof(void*);
+    (*len)++;
+}
+
+// Free space for a failed allocation by sliding chains in the long lived
+// section up to the end of the heap. Only chains reached from the data,
+// bytecode, const_table and map.table fields of str, bytes, function and dict
+// objects, and the qstr pools and the chunks their strings are in, are
+// candidates. A collection and a scan of the heap count every word that points
+// into a candidate, and it is moved only if the fields are all there is.
+// Returns true if anything moved.
+bool gc_compact(void) {
+    if (MP_STATE_MEM(gc_compacting) || !MP_STATE_MEM(gc_auto_collect_enabled)) {
+        return false;
+    }
+    MP_STATE_MEM(gc_compacting) = true;
+
+    // Memory is short so settle for a smaller table rather than collecting
+    // again for each size tried. When the free space is all in small holes,
+    // even a table of a few entries lets some chains move.
+    MP_STATE_MEM(gc_auto_collect_enabled) = false;
+    size_t max_len = MICROPY_GC_COMPACT_ENTRIES;
+    gc_compact_entry_t *table = gc_alloc(max_len * sizeof(gc_compact_entry_t), false, false);
+    while (table == NULL && max_len > 1) {
+        max_len /= 2;
+        table = gc_alloc(max_len * sizeof(gc_compact_entry_t), false, false);
+    }
+    MP_STATE_MEM(gc_auto_collect_enabled) = true;
+    if (table == NULL) {
+        MP_STATE_MEM(gc_compacting) = false;
+        return false;
+    }
+
+    GC_ENTER();
+    size_t total_blocks = MP_STATE_MEM(gc_alloc_table_byte_len) * BLOCKS_PER_ATB;
+    size_t table_block = BLOCK_FROM_PTR(table);
+    size_t len = 0;
+    for (size_t block = 0; block < total_blocks && len < max_len; block++) {
+        if (ATB_GET_KIND(block) != AT_HEAD || block == table_block) {
+            continue;
+        }
+        mp_obj_base_t *obj = (mp_obj_base_t*)PTR_FROM_BLOCK(block);
+        const mp_obj_type_t *type = obj->type;
+        if (type != &mp_type_str && type != &mp_type_bytes &&
+            type != &mp_type_fun_bc && type != &mp_type_dict) {
+            continue;
+        }
+        size_t n_bytes = gc_chain_length(block) * BYTES_PER_BLOCK;
+        if ((type == &mp_type_str || type == &mp_type_bytes) && n_bytes >= sizeof(mp_obj_str_t)) {
+            gc_compact_add(table, &len, max_len, &((mp_obj_str_t*)obj)->data);
+        } else if (type == &mp_type_fun_bc && n_bytes >= sizeof(mp_obj_fun_bc_t)) {
+            gc_compact_add(table, &len, max_len, &((mp_obj_fun_bc_t*)obj)->bytecode);
+            gc_compact_add(table, &len, max_len, &((mp_obj_fun_bc_t*)obj)->const_table);
+        } else if (type == &mp_type_dict && n_bytes >= sizeof(mp_obj_dict_t)) {
+            gc_compact_add(table, &len, max_len, &((mp_obj_dict_t*)obj)->map.table);
+        }
+    }
+    for (qstr_pool_t *qstr_pool = MP_STATE_VM(last_pool); VERIFY_PTR((void*)qstr_pool); qstr_pool = qstr_pool->prev) {
+        gc_compact_add(table, &len, max_len, &qstr_pool->prev);
+        for (size_t i = 0; i < qstr_pool->len; i++) {
+            gc_compact_add(table, &len, max_len, &qstr_pool->qstrs[i]);
+        }
+    }
+    // Sort by chain. The table is small so an insertion sort will do.
+    for (size_t i = 1; i < len; i++) {
+        gc_compact_entry_t entry = table[i];
+        size_t j = i;
+        for (; j > 0 && table[j - 1].block > entry.block; j--) {
+            table[j] = table[j - 1];
+        }
+        table[j] = entry;
+    }
+    for (size_t i = 0; i < len; i++) {
+        table[i].n_blocks = gc_chain_length(table[i].block);
+        table[i].n_refs = 0;
+    }
+
+    // Count the references from the roots while collecting. The table
+    // survives the collection because gc_collect_start marks it.
+    MP_STATE_MEM(gc_compact_table) = table;
+    MP_STATE_MEM(gc_compact_len) = len;
+    GC_EXIT();
+    gc_collect();
+    GC_ENTER();
+
+    // Then from the heap. Anything left is live now.
+    for (size_t block = 0; block < total_blocks; block++) {
+        if (ATB_GET_KIND(block) == AT_HEAD && block != table_block) {
+            size_t n_blocks = gc_chain_length(block);
+            gc_compact_count((void**)PTR_FROM_BLOCK(block), n_blocks * BYTES_PER_BLOCK / sizeof(void*));
+            block += n_blocks - 1;
+        }
+    }
+    // New qstrs are added to the last chunk, which isn't traced as a root.
+    gc_compact_count((void**)&MP_STATE_VM(qstr_last_chunk), 1);
+
+    // A chain can move if each reference to it is from a field in the table,
+    // the objects holding the fields survived the collection and none of them
+    // is inside a chain that moves.
+    void **pool = (void**)MP_STATE_MEM(gc_pool_start);
+    for (size_t i = 0; i < len; i++) {
+        size_t slot_block = table[i].slot * sizeof(void*) / BYTES_PER_BLOCK;
+        size_t owner = slot_block;
+        while (owner > 0 && ATB_GET_KIND(owner) == AT_TAIL) {
+            owner--;
+        }
+        size_t ptr_block = BLOCK_FROM_PTR(pool[table[i].slot]);
+        if (ATB_GET_KIND(owner) != AT_HEAD || ptr_block < table[i].block || ptr_block >= table[i].block + table[i].n_blocks) {
+            table[i].slot = GC_COMPACT_STALE;
+        } else {
+            gc_compact_entry_t *pinned = gc_compact_find(slot_block);
+            if (pinned != NULL) {
+                pinned->n_refs = (size_t)-1;
+            }
+        }
+    }
+    for (size_t i = 0; i < len; i++) {
+        if (table[i].slot != GC_COMPACT_STALE) {
+            gc_compact_entry_t *last = gc_compact_find(table[i].block);
+            if (last->n_refs != (size_t)-1) {
+                last->n_refs--;
+            }
+        }
+    }
+
+    // Slide the movable chains up, starting from the top of the heap.
+    size_t lowest_block = BLOCK_FROM_PTR(MP_STATE_MEM(gc_lowest_long_lived_ptr));
+    size_t dest = total_blocks;
+    bool moved = false;
+    for (size_t block = total_blocks; block-- > lowest_block;) {
+        if (ATB_GET_KIND(block) != AT_HEAD) {
+            continue;
+        }
+        size_t n_blocks = gc_chain_length(block);
+        gc_compact_entry_t *last = gc_compact_find(block);
+        size_t new_block = dest - n_blocks;
+        if (last == NULL || last->block != block || last->n_refs != 0 || new_block <= block) {
+            dest = block;
+            continue;
+        }
+        memmove((void*)PTR_FROM_BLOCK(new_block), (void*)PTR_FROM_BLOCK(block), n_blocks * BYTES_PER_BLOCK);
+        for (size_t bl = block; bl < block + n_blocks; bl++) {
+            ATB_ANY_TO_FREE(bl);
+        }
+        ATB_FREE_TO_HEAD(new_block);
+        for (size_t bl = new_block + 1; bl < new_block + n_blocks; bl++) {
+            ATB_FREE_TO_TAIL(bl);
+        }
+        for (gc_compact_entry_t *entry = last; entry >= table && entry->block == block; entry--) {
+            if (entry->slot != GC_COMPACT_STALE) {
+                pool[entry->slot] = (byte*)pool[entry->slot] + (new_block - block) * BYTES_PER_BLOCK;
+            }
+        }
+        dest = new_block;
+        moved = true;
+    }
+
+    if (moved) {
+        while (lowest_block < total_blocks && ATB_GET_KIND(lowest_block) == AT_FREE) {
+            lowest_block++;
+        }
+        MP_STATE_MEM(gc_lowest_long_lived_ptr) = (void*)PTR_FROM_BLOCK(lowest_block);
+        MP_STATE_MEM(gc_last_free_atb_index) = MP_STATE_MEM(gc_alloc_table_byte_len) - 1;
+    }
+    MP_STATE_MEM(gc_compact_table) = NULL;
+    GC_EXIT();
+    gc_free(table);
+    MP_STATE_MEM(gc_compacting) = false;
+    return moved;
+}
+#endif
+
+#if MICROPY_GC_PROFILE
+STATIC void gc_profile_alloc(size_t n_bytes, const void *caller) {
+    const mp_code_state_t *code_state = MP_STATE_THREAD(current_code_state);
+    const void *key = code_state != NULL ? code_state->ip : caller;
+    gc_profile_site_t *sites = MP_STATE_MEM(gc_profile_sites);
+    size_t n_sites = MP_STATE_MEM(gc_profile_n_sites);
+    gc_profile_site_t *site = NULL;
+    for (size_t i = 0; i < n_sites; i++) {
+        if (sites[i].key == key) {
+            site = &sites[i];
+            break;
+        }
+    }
+    if (site == NULL) {
+        if (n_sites == MICROPY_GC_PROFILE_SITES) {
+            MP_STATE_MEM(gc_profile_other_count)++;
+            MP_STATE_MEM(gc_profile_other_bytes) += n_bytes;
+            return;
+        }
+        // Look the line up now; the bytecode may be gone by the time the
+        // profile is printed.
+        site = &sites[n_sites];
+        MP_STATE_MEM(gc_profile_n_sites) = n_sites + 1;
+        site->key = key;
+        site->count = 0;
+        site->bytes = 0;
+        if (code_state != NULL) {
+            site->line = mp_bytecode_get_source_line(code_state->fun_bc->bytecode, code_state->ip,
+                &site->block_name, &site->source_file);
+        } else {
+            site->block_name = MP_QSTR_NULL;
+            site->source_file = MP_QSTR_NULL;
+            site->line = 0;
+        }
+    }
+    site->count++;
+    site->bytes += n_bytes;
+}
+#endif
+
 // We place long lived objects at the end of the heap rather than the start. This reduces
 // fragmentation by localizing the heap churn to one portion of memory (the start of the heap.)
+#if MICROPY_GC_PROFILE
 void *gc_alloc(size_t n_bytes, bool has_finaliser, bool long_lived) {
+    return gc_alloc_from(n_bytes, has_finaliser, long_lived, __builtin_return_address(0));
+}
+
+void *gc_alloc_from(size_t n_bytes, bool has_finaliser, bool long_lived, const void *caller) {
+#else
+void *gc_alloc(size_t n_bytes, bool has_finaliser, bool long_lived) {
+#endif
     size_t n_blocks = ((n_bytes + BYTES_PER_BLOCK - 1) & (~(BYTES_PER_BLOCK - 1))) / BYTES_PER_BLOCK;
     DEBUG_printf("gc_alloc(" UINT_FMT " bytes -> " UINT_FMT " blocks)\n", n_bytes, n_blocks);
 
@@ -500,7 +1074,6 @@ void *gc_alloc(size_t n_bytes, bool has_finaliser, bool long_lived) {
     size_t found_block = 0xffffffff;
     size_t end_block;
     size_t start_block;
-    size_t n_free;
     bool collected = !MP_STATE_MEM(gc_auto_collect_enabled);
 
     #if MICROPY_GC_ALLOC_THRESHOLD
@@ -513,53 +1086,51 @@ void *gc_alloc(size_t n_bytes, bool has_finaliser, bool long_lived) {
     #endif
 
     bool keep_looking = true;
+    bool from_free_list = false;
+    #if MICROPY_GC_COMPACT
+    bool compacted = false;
+    #endif
+
+    #if MICROPY_GC_FREE_LIST_LEN
+    if (!long_lived && n_blocks <= MICROPY_GC_FREE_LIST_CLASSES) {
+        size_t block = gc_free_list_take(n_blocks);
+        if (block != 0xffffffff) {
+            found_block = block + n_blocks - 1;
+            keep_looking = false;
+            from_free_list = true;
+        }
+    }
+    #endif
 
     // When we start searching on the other side of the crossover block we make sure to
     // perform a collect. That way we'll get the closest free block in our section.
     size_t crossover_block = BLOCK_FROM_PTR(MP_STATE_MEM(gc_lowest_long_lived_ptr));
     while (keep_looking) {
-        int8_t direction = 1;
         size_t bucket = MIN(n_blocks, MICROPY_ATB_INDICES) - 1;
         size_t first_free = MP_STATE_MEM(gc_first_free_atb_index)[bucket];
-        size_t start = first_free;
-        if (long_lived) {
-            direction = -1;
-            start = MP_STATE_MEM(gc_last_free_atb_index);
-        }
-        n_free = 0;
+        size_t last_free = MP_STATE_MEM(gc_last_free_atb_index);
         // look for a run of n_blocks available blocks
-        for (size_t i = start; keep_looking && first_free <= i && i <= MP_STATE_MEM(gc_last_free_atb_index); i += direction) {
-            byte a = MP_STATE_MEM(gc_alloc_table_start)[i];
-            // Four ATB states are packed into a single byte.
-            int j = 0;
-            if (direction == -1) {
-                j = 3;
-            }
-            for (; keep_looking && 0 <= j && j <= 3; j += direction) {
-                if ((a & (0x3 << (j * 2))) == 0) {
-                    if (++n_free >= n_blocks) {
-                        found_block = i * BLOCKS_PER_ATB + j;
-                        keep_looking = false;
-                    }
-                } else {
-                    if (!collected) {
-                        size_t block = i * BLOCKS_PER_ATB + j;
-                        if ((direction == 1 && block >= crossover_block) ||
-                                (direction == -1 && block < crossover_block)) {
-                            keep_looking = false;
-                        }
-                    }
-                    n_free = 0;
-                }
-            }
+        if (!long_lived) {
+            found_block = gc_find_free_run_up(n_blocks, first_free, last_free, collected ? (size_t)-1 : crossover_block);
+        } else {
+            found_block = gc_find_free_run_down(n_blocks, first_free, last_free, collected ? 0 : crossover_block);
         }
-        if (n_free >= n_blocks) {
+        if (found_block != 0xffffffff) {
             break;
         }
 
         GC_EXIT();
         // nothing found!
         if (collected) {
+            #if MICROPY_GC_COMPACT
+            if (!compacted) {
+                compacted = true;
+                if (gc_compact()) {
+                    GC_ENTER();
+                    continue;
+                }
+            }
+            #endif
             return NULL;
         }
         DEBUG_printf("gc_alloc(" UINT_FMT "): no free mem, triggering GC\n", n_bytes);
@@ -577,8 +1148,10 @@ void *gc_alloc(size_t n_bytes, bool has_finaliser, bool long_lived) {
     // adjusting (see gc_realloc and gc_free).
     if (!long_lived) {
         end_block = found_block;
-        start_block = found_block - n_free + 1;
-        if (n_blocks < MICROPY_ATB_INDICES) {
+        start_block = found_block - n_blocks + 1;
+        // A run from the free lists may lie above free runs the ATB scan
+        // hasn't reached yet, so it can't advance the scan indices.
+        if (n_blocks < MICROPY_ATB_INDICES && !from_free_list) {
             size_t next_free_atb = (found_block + n_blocks) / BLOCKS_PER_ATB;
             // Update all atb indices for larger blocks too.
             for (size_t i = n_blocks - 1; i < MICROPY_ATB_INDICES; i++) {
@@ -587,7 +1160,7 @@ void *gc_alloc(size_t n_bytes, bool has_finaliser, bool long_lived) {
         }
     } else {
         start_block = found_block;
-        end_block = found_block + n_free - 1;
+        end_block = found_block + n_blocks - 1;
         // Always update the bounds of the long lived area because we assume it is contiguous. (It
         // can still be reset by a sweep.)
         MP_STATE_MEM(gc_last_free_atb_index) = (found_block - 1) / BLOCKS_PER_ATB;
@@ -622,6 +1195,10 @@ void *gc_alloc(size_t n_bytes, bool has_finaliser, bool long_lived) {
     MP_STATE_MEM(gc_alloc_amount) += n_blocks;
     #endif
 
+    #if MICROPY_GC_PROFILE
+    gc_profile_alloc(n_bytes, caller);
+    #endif
+
     GC_EXIT();
 
     #if MICROPY_GC_CONSERVATIVE_CLEAR
@@ -717,6 +1294,14 @@ void gc_free(void *ptr) {
             MP_STATE_MEM(gc_last_free_atb_index) = new_free_atb;
         }
 
+        #if MICROPY_GC_FREE_LIST_LEN
+        // Small blocks are likely to be reused for the same size soon.
+        size_t n_free = gc_free_list_run_length(start_block);
+        if (n_free > 0) {
+            gc_free_list_push(start_block, n_free);
+        }
+        #endif
+
         GC_EXIT();
 
         #if EXTENSIVE_HEAP_PROFILING
@@ -818,10 +1403,21 @@ void *gc_realloc(void *ptr, mp_uint_t n_bytes) {
 
 #else // Alternative gc_realloc impl
 
+#if MICROPY_GC_PROFILE
+void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
+    return gc_realloc_from(ptr_in, n_bytes, allow_move, __builtin_return_address(0));
+}
+
+// A chain that has to move is profiled as an allocation made by the caller.
+#define GC_REALLOC_ALLOC(n_bytes, has_finaliser) gc_alloc_from((n_bytes), (has_finaliser), false, caller)
+void *gc_realloc_from(void *ptr_in, size_t n_bytes, bool allow_move, const void *caller) {
+#else
+#define GC_REALLOC_ALLOC(n_bytes, has_finaliser) gc_alloc((n_bytes), (has_finaliser), false)
 void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
+#endif
     // check for pure allocation
     if (ptr_in == NULL) {
-        return gc_alloc(n_bytes, false, false);
+        return GC_REALLOC_ALLOC(n_bytes, false);
     }
 
     // check for pure free
@@ -952,7 +1548,7 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
     }
 
     // can't resize inplace; try to find a new contiguous chain
-    void *ptr_out = gc_alloc(n_bytes, ftb_state, false);
+    void *ptr_out = GC_REALLOC_ALLOC(n_bytes, ftb_state);
 
     // check that the alloc succeeded
     if (ptr_out == NULL) {
@@ -964,6 +1560,7 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
     gc_free(ptr_in);
     return ptr_out;
 }
+#undef GC_REALLOC_ALLOC
 #endif // Alternative gc_realloc impl
 
 bool gc_never_free(void *ptr) {
@@ -1005,6 +1602,65 @@ void gc_dump_info(void) {
            (uint)info.num_1block, (uint)info.num_2block, (uint)info.max_block, (uint)info.max_free);
 }
 
+#if MICROPY_GC_PROFILE
+void gc_profile_reset(void) {
+    GC_ENTER();
+    MP_STATE_MEM(gc_profile_n_sites) = 0;
+    MP_STATE_MEM(gc_profile_other_count) = 0;
+    MP_STATE_MEM(gc_profile_other_bytes) = 0;
+    MP_STATE_MEM(gc_profile_collections) = 0;
+    MP_STATE_MEM(gc_profile_pause_total) = 0;
+    MP_STATE_MEM(gc_profile_pause_max) = 0;
+    GC_EXIT();
+}
+
+void gc_dump_profile(void) {
+    GC_ENTER();
+    // Sites are recorded per opcode. Merge those on the same line, then sort
+    // them so the most bytes come first.
+    gc_profile_site_t *sites = MP_STATE_MEM(gc_profile_sites);
+    size_t n_sites = MP_STATE_MEM(gc_profile_n_sites);
+    for (size_t i = 0; i < n_sites; i++) {
+        for (size_t j = i + 1; j < n_sites;) {
+            if (sites[i].block_name != MP_QSTR_NULL && sites[j].block_name == sites[i].block_name &&
+                sites[j].source_file == sites[i].source_file && sites[j].line == sites[i].line) {
+                sites[i].count += sites[j].count;
+                sites[i].bytes += sites[j].bytes;
+                sites[j] = sites[--n_sites];
+            } else {
+                j++;
+            }
+        }
+    }
+    MP_STATE_MEM(gc_profile_n_sites) = n_sites;
+    for (size_t i = 1; i < n_sites; i++) {
+        gc_profile_site_t site = sites[i];
+        size_t j = i;
+        for (; j > 0 && sites[j - 1].bytes < site.bytes; j--) {
+            sites[j] = sites[j - 1];
+        }
+        sites[j] = site;
+    }
+    mp_printf(&mp_plat_print, "GC: collections: %u, pause total: %u us, max: %u us\n",
+        (uint)MP_STATE_MEM(gc_profile_collections), (uint)MP_STATE_MEM(gc_profile_pause_total),
+        (uint)MP_STATE_MEM(gc_profile_pause_max));
+    mp_printf(&mp_plat_print, "   allocs      bytes site\n");
+    for (size_t i = 0; i < n_sites; i++) {
+        mp_printf(&mp_plat_print, "%9u %10u ", (uint)sites[i].count, (uint)sites[i].bytes);
+        if (sites[i].block_name != MP_QSTR_NULL) {
+            mp_printf(&mp_plat_print, "%q:%u in %q\n", sites[i].source_file, (uint)sites[i].line, sites[i].block_name);
+        } else {
+            mp_printf(&mp_plat_print, "native %p\n", sites[i].key);
+        }
+    }
+    if (MP_STATE_MEM(gc_profile_other_count) > 0) {
+        mp_printf(&mp_plat_print, "%9u %10u other\n",
+            (uint)MP_STATE_MEM(gc_profile_other_count), (uint)MP_STATE_MEM(gc_profile_other_bytes));
+    }
+    GC_EXIT();
+}
+#endif
+
 void gc_dump_alloc_table(void) {
     GC_ENTER();
     static const size_t DUMP_BYTES_PER_LINE = 64;
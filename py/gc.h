@@ -52,6 +52,11 @@ void gc_unlock(void);
 bool gc_is_locked(void);
 
 // A given port must implement gc_collect by using the other collect functions.
+// With MICROPY_GC_COMPACT, heap data may move when an allocation fails. Every
+// pointer into the heap that is held outside of it (static data, supervisor
+// allocations, peripheral registers) must then be passed to gc_collect_root or
+// gc_collect_ptr on each collection, even if the data is otherwise kept alive.
+// A pointer that isn't reported is not updated when its data moves.
 void gc_collect(void);
 void gc_collect_start(void);
 void gc_collect_ptr(void *ptr);
@@ -65,12 +70,25 @@ void *gc_alloc(size_t n_bytes, bool has_finaliser, bool long_lived);
 // Use this function to sweep the whole heap and run all finalisers
 void gc_sweep_all(void);
 
+#if MICROPY_GC_COMPACT
+// Collect and then slide movable data in the long lived section up to the end
+// of the heap. Returns true if anything moved.
+bool gc_compact(void);
+#endif
+
 void gc_free(void *ptr); // does not call finaliser
 size_t gc_nbytes(const void *ptr);
 bool gc_has_finaliser(const void *ptr);
 void *gc_make_long_lived(void *old_ptr);
 void *gc_realloc(void *ptr, size_t n_bytes, bool allow_move);
 
+#if MICROPY_GC_PROFILE
+// Like gc_alloc and gc_realloc, but the allocation profile records caller as
+// the native call site instead of the function calling these.
+void *gc_alloc_from(size_t n_bytes, bool has_finaliser, bool long_lived, const void *caller);
+void *gc_realloc_from(void *ptr, size_t n_bytes, bool allow_move, const void *caller);
+#endif
+
 // Prevents a pointer from ever being freed because it establishes a permanent reference to it. Use
 // very sparingly because it can leak memory.
 bool gc_never_free(void *ptr);
@@ -89,4 +107,10 @@ void gc_info(gc_info_t *info);
 void gc_dump_info(void);
 void gc_dump_alloc_table(void);
 
+#if MICROPY_GC_PROFILE
+// Print the allocations made from each call site and the collection times.
+void gc_dump_profile(void);
+void gc_profile_reset(void);
+#endif
+
 #endif // MICROPY_INCLUDED_PY_GC_H
@@ -56,13 +56,25 @@
 #undef malloc
 #undef free
 #undef realloc
-#define malloc_ll(b, ll) gc_alloc((b), false, (ll))
+#if MICROPY_GC_PROFILE
+// Pass the code calling the m_ functions down, so that the allocation profile
+// shows it as the call site rather than a line of this file.
+#define CALLER() __builtin_return_address(0)
+#define malloc_ll(b, ll, c) gc_alloc_from((b), false, (ll), (c))
+#define malloc_with_finaliser(b) gc_alloc_from((b), true, false, CALLER())
+#define realloc(ptr, n) gc_realloc_from(ptr, n, true, CALLER())
+#define realloc_ext(ptr, n, mv) gc_realloc_from(ptr, n, mv, CALLER())
+#else
+#define CALLER() NULL
+#define malloc_ll(b, ll, c) gc_alloc((b), false, (ll))
 #define malloc_with_finaliser(b) gc_alloc((b), true, false)
-#define free gc_free
 #define realloc(ptr, n) gc_realloc(ptr, n, true)
 #define realloc_ext(ptr, n, mv) gc_realloc(ptr, n, mv)
+#endif
+#define free gc_free
 #else
-#define malloc_ll(b, ll) malloc(b)
+#define CALLER() NULL
+#define malloc_ll(b, ll, c) malloc(b)
 #define malloc_with_finaliser(b) malloc((b))
 
 STATIC void *realloc_ext(void *ptr, size_t n_bytes, bool allow_move) {
@@ -77,8 +89,9 @@ STATIC void *realloc_ext(void *ptr, size_t n_bytes, bool allow_move) {
 }
 #endif // MICROPY_ENABLE_GC
 
-void *m_malloc(size_t num_bytes, bool long_lived) {
-    void *ptr = malloc_ll(num_bytes, long_lived);
+STATIC void *m_malloc_from(size_t num_bytes, bool long_lived, const void *caller) {
+    (void)caller;
+    void *ptr = malloc_ll(num_bytes, long_lived, caller);
     if (ptr == NULL && num_bytes != 0) {
         m_malloc_fail(num_bytes);
     }
@@ -91,8 +104,12 @@ void *m_malloc(size_t num_bytes, bool long_lived) {
     return ptr;
 }
 
+void *m_malloc(size_t num_bytes, bool long_lived) {
+    return m_malloc_from(num_bytes, long_lived, CALLER());
+}
+
 void *m_malloc_maybe(size_t num_bytes, bool long_lived) {
-    void *ptr = malloc_ll(num_bytes, long_lived);
+    void *ptr = malloc_ll(num_bytes, long_lived, CALLER());
 #if MICROPY_MEM_STATS
     MP_STATE_MEM(total_bytes_allocated) += num_bytes;
     MP_STATE_MEM(current_bytes_allocated) += num_bytes;
@@ -119,7 +136,7 @@ void *m_malloc_with_finaliser(size_t num_bytes) {
 #endif
 
 void *m_malloc0(size_t num_bytes, bool long_lived) {
-    void *ptr = m_malloc(num_bytes, long_lived);
+    void *ptr = m_malloc_from(num_bytes, long_lived, CALLER());
     // If this config is set then the GC clears all memory, so we don't need to.
     #if !MICROPY_GC_CONSERVATIVE_CLEAR
     memset(ptr, 0, num_bytes);
@@ -41,6 +41,14 @@ STATIC mp_obj_t py_gc_collect(void) {
 }
 MP_DEFINE_CONST_FUN_OBJ_0(gc_collect_obj, py_gc_collect);
 
+#if MICROPY_GC_COMPACT
+// compact(): collect and move long lived data to the end of the heap
+STATIC mp_obj_t py_gc_compact(void) {
+    return mp_obj_new_bool(gc_compact());
+}
+MP_DEFINE_CONST_FUN_OBJ_0(gc_compact_obj, py_gc_compact);
+#endif
+
 // disable(): disable the garbage collector
 STATIC mp_obj_t gc_disable(void) {
     MP_STATE_MEM(gc_auto_collect_enabled) = 0;
@@ -95,9 +103,35 @@ STATIC mp_obj_t gc_threshold(size_t n_args, const mp_obj_t *args) {
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(gc_threshold_obj, 0, 1, gc_threshold);
 #endif
 
+#if MICROPY_GC_PROFILE
+// stats(): return the number of allocations and bytes allocated, and the number
+// of collections with their total and longest pause in microseconds, since
+// the profile was last reset
+STATIC mp_obj_t gc_stats(void) {
+    size_t count = MP_STATE_MEM(gc_profile_other_count);
+    size_t bytes = MP_STATE_MEM(gc_profile_other_bytes);
+    for (size_t i = 0; i < MP_STATE_MEM(gc_profile_n_sites); i++) {
+        count += MP_STATE_MEM(gc_profile_sites)[i].count;
+        bytes += MP_STATE_MEM(gc_profile_sites)[i].bytes;
+    }
+    mp_obj_t items[5] = {
+        mp_obj_new_int_from_uint(count),
+        mp_obj_new_int_from_uint(bytes),
+        mp_obj_new_int_from_uint(MP_STATE_MEM(gc_profile_collections)),
+        mp_obj_new_int_from_uint(MP_STATE_MEM(gc_profile_pause_total)),
+        mp_obj_new_int_from_uint(MP_STATE_MEM(gc_profile_pause_max)),
+    };
+    return mp_obj_new_tuple(5, items);
+}
+MP_DEFINE_CONST_FUN_OBJ_0(gc_stats_obj, gc_stats);
+#endif
+
 STATIC const mp_rom_map_elem_t mp_module_gc_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_gc) },
     { MP_ROM_QSTR(MP_QSTR_collect), MP_ROM_PTR(&gc_collect_obj) },
+    #if MICROPY_GC_COMPACT
+    { MP_ROM_QSTR(MP_QSTR_compact), MP_ROM_PTR(&gc_compact_obj) },
+    #endif
     { MP_ROM_QSTR(MP_QSTR_disable), MP_ROM_PTR(&gc_disable_obj) },
     { MP_ROM_QSTR(MP_QSTR_enable), MP_ROM_PTR(&gc_enable_obj) },
     { MP_ROM_QSTR(MP_QSTR_isenabled), MP_ROM_PTR(&gc_isenabled_obj) },
@@ -106,6 +140,9 @@ STATIC const mp_rom_map_elem_t mp_module_gc_globals_table[] = {
     #if MICROPY_GC_ALLOC_THRESHOLD
     { MP_ROM_QSTR(MP_QSTR_threshold), MP_ROM_PTR(&gc_threshold_obj) },
     #endif
+    #if MICROPY_GC_PROFILE
+    { MP_ROM_QSTR(MP_QSTR_stats), MP_ROM_PTR(&gc_stats_obj) },
+    #endif
 };
 
 STATIC MP_DEFINE_CONST_DICT(mp_module_gc_globals, mp_module_gc_globals_table);
@@ -123,6 +123,18 @@ STATIC mp_obj_t mp_micropython_pystack_use(void) {
 STATIC MP_DEFINE_CONST_FUN_OBJ_0(mp_micropython_pystack_use_obj, mp_micropython_pystack_use);
 #endif
 
+#if MICROPY_GC_PROFILE
+STATIC mp_obj_t mp_micropython_alloc_profile(size_t n_args, const mp_obj_t *args) {
+    gc_dump_profile();
+    if (n_args == 1 && mp_obj_is_true(args[0])) {
+        // true arg given means start a new profile
+        gc_profile_reset();
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mp_micropython_alloc_profile_obj, 0, 1, mp_micropython_alloc_profile);
+#endif
+
 #if MICROPY_ENABLE_GC
 STATIC mp_obj_t mp_micropython_heap_lock(void) {
     gc_lock();
@@ -187,6 +199,9 @@ STATIC const mp_rom_map_elem_t mp_module_micropython_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_heap_lock), MP_ROM_PTR(&mp_micropython_heap_lock_obj) },
     { MP_ROM_QSTR(MP_QSTR_heap_unlock), MP_ROM_PTR(&mp_micropython_heap_unlock_obj) },
     #endif
+    #if MICROPY_GC_PROFILE
+    { MP_ROM_QSTR(MP_QSTR_alloc_profile), MP_ROM_PTR(&mp_micropython_alloc_profile_obj) },
+    #endif
     #if MICROPY_KBD_EXCEPTION
     { MP_ROM_QSTR(MP_QSTR_kbd_intr), MP_ROM_PTR(&mp_micropython_kbd_intr_obj) },
     #endif
@@ -0,0 +1,242 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/bc.h"
+#include "py/bc0.h"
+#include "py/mpstate.h"
+#include "py/objlist.h"
+#include "py/runtime.h"
+
+#if MICROPY_VM_PROFILE
+
+STATIC const char *const uprofile_opcode_names[MP_BC_LOAD_CONST_SMALL_INT_MULTI] = {
+    [MP_BC_LOAD_CONST_FALSE] = "LOAD_CONST_FALSE",
+    [MP_BC_LOAD_CONST_NONE] = "LOAD_CONST_NONE",
+    [MP_BC_LOAD_CONST_TRUE] = "LOAD_CONST_TRUE",
+    [MP_BC_LOAD_CONST_SMALL_INT] = "LOAD_CONST_SMALL_INT",
+    [MP_BC_LOAD_CONST_STRING] = "LOAD_CONST_STRING",
+    [MP_BC_LOAD_CONST_OBJ] = "LOAD_CONST_OBJ",
+    [MP_BC_LOAD_NULL] = "LOAD_NULL",
+    [MP_BC_LOAD_FAST_N] = "LOAD_FAST_N",
+    [MP_BC_LOAD_DEREF] = "LOAD_DEREF",
+    [MP_BC_LOAD_NAME] = "LOAD_NAME",
+    [MP_BC_LOAD_GLOBAL] = "LOAD_GLOBAL",
+    [MP_BC_LOAD_ATTR] = "LOAD_ATTR",
+    [MP_BC_LOAD_METHOD] = "LOAD_METHOD",
+    [MP_BC_LOAD_SUPER_METHOD] = "LOAD_SUPER_METHOD",
+    [MP_BC_LOAD_BUILD_CLASS] = "LOAD_BUILD_CLASS",
+    [MP_BC_LOAD_SUBSCR] = "LOAD_SUBSCR",
+    [MP_BC_STORE_FAST_N] = "STORE_FAST_N",
+    [MP_BC_STORE_DEREF] = "STORE_DEREF",
+    [MP_BC_STORE_NAME] = "STORE_NAME",
+    [MP_BC_STORE_GLOBAL] = "STORE_GLOBAL",
+    [MP_BC_STORE_ATTR] = "STORE_ATTR",
+    [MP_BC_STORE_SUBSCR] = "STORE_SUBSCR",
+    [MP_BC_DELETE_FAST] = "DELETE_FAST",
+    [MP_BC_DELETE_DEREF] = "DELETE_DEREF",
+    [MP_BC_DELETE_NAME] = "DELETE_NAME",
+    [MP_BC_DELETE_GLOBAL] = "DELETE_GLOBAL",
+    [MP_BC_DUP_TOP] = "DUP_TOP",
+    [MP_BC_DUP_TOP_TWO] = "DUP_TOP_TWO",
+    [MP_BC_POP_TOP] = "POP_TOP",
+    [MP_BC_ROT_TWO] = "ROT_TWO",
+    [MP_BC_ROT_THREE] = "ROT_THREE",
+    [MP_BC_JUMP] = "JUMP",
+    [MP_BC_POP_JUMP_IF_TRUE] = "POP_JUMP_IF_TRUE",
+    [MP_BC_POP_JUMP_IF_FALSE] = "POP_JUMP_IF_FALSE",
+    [MP_BC_JUMP_IF_TRUE_OR_POP] = "JUMP_IF_TRUE_OR_POP",
+    [MP_BC_JUMP_IF_FALSE_OR_POP] = "JUMP_IF_FALSE_OR_POP",
+    [MP_BC_SETUP_WITH] = "SETUP_WITH",
+    [MP_BC_WITH_CLEANUP] = "WITH_CLEANUP",
+    [MP_BC_SETUP_EXCEPT] = "SETUP_EXCEPT",
+    [MP_BC_SETUP_FINALLY] = "SETUP_FINALLY",
+    [MP_BC_END_FINALLY] = "END_FINALLY",
+    [MP_BC_GET_ITER] = "GET_ITER",
+    [MP_BC_FOR_ITER] = "FOR_ITER",
+    [MP_BC_POP_BLOCK] = "POP_BLOCK",
+    [MP_BC_POP_EXCEPT] = "POP_EXCEPT",
+    [MP_BC_UNWIND_JUMP] = "UNWIND_JUMP",
+    [MP_BC_GET_ITER_STACK] = "GET_ITER_STACK",
+    [MP_BC_LOAD_FAST_FAST_BINARY_OP] = "LOAD_FAST_FAST_BINARY_OP",
+    [MP_BC_LOAD_FAST_CONST_BINARY_OP] = "LOAD_FAST_CONST_BINARY_OP",
+    [MP_BC_FOR_RANGE] = "FOR_RANGE",
+    [MP_BC_BUILD_TUPLE] = "BUILD_TUPLE",
+    [MP_BC_BUILD_LIST] = "BUILD_LIST",
+    [MP_BC_BUILD_MAP] = "BUILD_MAP",
+    [MP_BC_STORE_MAP] = "STORE_MAP",
+    [MP_BC_BUILD_SET] = "BUILD_SET",
+    [MP_BC_BUILD_SLICE] = "BUILD_SLICE",
+    [MP_BC_STORE_COMP] = "STORE_COMP",
+    [MP_BC_UNPACK_SEQUENCE] = "UNPACK_SEQUENCE",
+    [MP_BC_UNPACK_EX] = "UNPACK_EX",
+    [MP_BC_RETURN_VALUE] = "RETURN_VALUE",
+    [MP_BC_RAISE_VARARGS] = "RAISE_VARARGS",
+    [MP_BC_YIELD_VALUE] = "YIELD_VALUE",
+    [MP_BC_YIELD_FROM] = "YIELD_FROM",
+    [MP_BC_MAKE_FUNCTION] = "MAKE_FUNCTION",
+    [MP_BC_MAKE_FUNCTION_DEFARGS] = "MAKE_FUNCTION_DEFARGS",
+    [MP_BC_MAKE_CLOSURE] = "MAKE_CLOSURE",
+    [MP_BC_MAKE_CLOSURE_DEFARGS] = "MAKE_CLOSURE_DEFARGS",
+    [MP_BC_CALL_FUNCTION] = "CALL_FUNCTION",
+    [MP_BC_CALL_FUNCTION_VAR_KW] = "CALL_FUNCTION_VAR_KW",
+    [MP_BC_CALL_METHOD] = "CALL_METHOD",
+    [MP_BC_CALL_METHOD_VAR_KW] = "CALL_METHOD_VAR_KW",
+    [MP_BC_IMPORT_NAME] = "IMPORT_NAME",
+    [MP_BC_IMPORT_FROM] = "IMPORT_FROM",
+    [MP_BC_IMPORT_STAR] = "IMPORT_STAR",
+};
+
+// Returns the first opcode of the group op is reported in. The opcodes that
+// encode a small int or local are grouped together; those that encode an
+// operator are not.
+STATIC size_t uprofile_opcode_group(size_t op) {
+    if (MP_BC_LOAD_CONST_SMALL_INT_MULTI <= op && op < MP_BC_LOAD_FAST_MULTI) {
+        return MP_BC_LOAD_CONST_SMALL_INT_MULTI;
+    } else if (MP_BC_LOAD_FAST_MULTI <= op && op < MP_BC_STORE_FAST_MULTI) {
+        return MP_BC_LOAD_FAST_MULTI;
+    } else if (MP_BC_STORE_FAST_MULTI <= op && op < MP_BC_STORE_FAST_MULTI + 16) {
+        return MP_BC_STORE_FAST_MULTI;
+    }
+    return op;
+}
+
+STATIC mp_obj_t uprofile_opcode_name(size_t op) {
+    vstr_t vstr;
+    vstr_init(&vstr, 16);
+    if (op < MP_BC_LOAD_CONST_SMALL_INT_MULTI && uprofile_opcode_names[op] != NULL) {
+        vstr_add_str(&vstr, uprofile_opcode_names[op]);
+    } else if (op == MP_BC_LOAD_CONST_SMALL_INT_MULTI) {
+        vstr_add_str(&vstr, "LOAD_CONST_SMALL_INT_MULTI");
+    } else if (op == MP_BC_LOAD_FAST_MULTI) {
+        vstr_add_str(&vstr, "LOAD_FAST_MULTI");
+    } else if (op == MP_BC_STORE_FAST_MULTI) {
+        vstr_add_str(&vstr, "STORE_FAST_MULTI");
+    } else if (MP_BC_UNARY_OP_MULTI <= op && op < MP_BC_UNARY_OP_MULTI + MP_UNARY_OP_NUM_BYTECODE) {
+        vstr_printf(&vstr, "UNARY_OP %q", mp_unary_op_method_name[op - MP_BC_UNARY_OP_MULTI]);
+    } else if (MP_BC_BINARY_OP_MULTI <= op && op < MP_BC_BINARY_OP_MULTI + MP_BINARY_OP_NUM_BYTECODE) {
+        vstr_printf(&vstr, "BINARY_OP %q", mp_binary_op_method_name[op - MP_BC_BINARY_OP_MULTI]);
+    } else {
+        vstr_printf(&vstr, "0x%02x", (uint)op);
+    }
+    return mp_obj_new_str_from_vstr(&mp_type_str, &vstr);
+}
+
+// Sort a list of tuples by the given item of each tuple, largest first.
+STATIC void uprofile_sort(mp_obj_t list, size_t index) {
+    size_t len;
+    mp_obj_t *items;
+    mp_obj_list_get(list, &len, &items);
+    for (size_t i = 1; i < len; i++) {
+        mp_obj_t item = items[i];
+        mp_obj_t key = mp_obj_subscr(item, MP_OBJ_NEW_SMALL_INT(index), MP_OBJ_SENTINEL);
+        size_t j = i;
+        for (; j > 0; j--) {
+            mp_obj_t prev_key = mp_obj_subscr(items[j - 1], MP_OBJ_NEW_SMALL_INT(index), MP_OBJ_SENTINEL);
+            if (!mp_obj_is_true(mp_binary_op(MP_BINARY_OP_LESS, prev_key, key))) {
+                break;
+            }
+            items[j] = items[j - 1];
+        }
+        items[j] = item;
+    }
+}
+
+// opcodes(): return (name, count) tuples of the opcodes executed, most first
+STATIC mp_obj_t uprofile_opcodes(void) {
+    mp_obj_t list = mp_obj_new_list(0, NULL);
+    const mp_uint_t *counts = MP_STATE_VM(vm_profile_opcodes);
+    for (size_t op = 0; op < 256;) {
+        size_t group = uprofile_opcode_group(op);
+        mp_uint_t count = 0;
+        for (; op < 256 && uprofile_opcode_group(op) == group; op++) {
+            count += counts[op];
+        }
+        if (count > 0) {
+            mp_obj_t items[2] = {
+                uprofile_opcode_name(group),
+                mp_obj_new_int_from_uint(count),
+            };
+            mp_obj_list_append(list, mp_obj_new_tuple(2, items));
+        }
+    }
+    uprofile_sort(list, 1);
+    return list;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_0(uprofile_opcodes_obj, uprofile_opcodes);
+
+// functions(): return (name, file, line, calls, time) tuples of the bytecode
+// functions run, most time first. The VM finds the entries by the address of
+// the bytecode, so a function whose bytecode is copied to the long lived
+// section or moved by a compaction gets a second entry, and a function freed
+// while profiling may have its counts added to whichever function's bytecode
+// is later allocated at the same address.
+STATIC mp_obj_t uprofile_functions(void) {
+    mp_obj_t list = mp_obj_new_list(0, NULL);
+    const mp_vm_profile_function_t *functions = MP_STATE_VM(vm_profile_functions);
+    for (size_t i = 0; i <= MICROPY_VM_PROFILE_FUNCTIONS; i++) {
+        const mp_vm_profile_function_t *f = &functions[i];
+        if (f->calls == 0) {
+            continue;
+        }
+        mp_obj_t items[5] = {
+            mp_const_none,
+            mp_const_none,
+            mp_const_none,
+            mp_obj_new_int_from_uint(f->calls),
+            mp_obj_new_int_from_uint(f->time),
+        };
+        if (f->bytecode != NULL) {
+            items[0] = MP_OBJ_NEW_QSTR(f->block_name);
+            items[1] = MP_OBJ_NEW_QSTR(f->source_file);
+            items[2] = MP_OBJ_NEW_SMALL_INT(f->line);
+        }
+        mp_obj_list_append(list, mp_obj_new_tuple(5, items));
+    }
+    uprofile_sort(list, 4);
+    return list;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_0(uprofile_functions_obj, uprofile_functions);
+
+// reset(): clear the opcode and function counts
+STATIC mp_obj_t uprofile_reset(void) {
+    mp_vm_profile_reset();
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_0(uprofile_reset_obj, uprofile_reset);
+
+STATIC const mp_rom_map_elem_t mp_module_uprofile_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_uprofile) },
+    { MP_ROM_QSTR(MP_QSTR_opcodes), MP_ROM_PTR(&uprofile_opcodes_obj) },
+    { MP_ROM_QSTR(MP_QSTR_functions), MP_ROM_PTR(&uprofile_functions_obj) },
+    { MP_ROM_QSTR(MP_QSTR_reset), MP_ROM_PTR(&uprofile_reset_obj) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(mp_module_uprofile_globals, mp_module_uprofile_globals_table);
+
+const mp_obj_module_t mp_module_uprofile = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t*)&mp_module_uprofile_globals,
+};
+
+#endif // MICROPY_VM_PROFILE
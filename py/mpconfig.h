@@ -234,6 +234,24 @@
 #define MICROPY_STACKLESS_STRICT (0)
 #endif
 
+// Whether the VM counts the opcodes it executes, and the calls into and time
+// spent in each bytecode function, for the uprofile module. With
+// MICROPY_STACKLESS, calls made by the VM itself are counted in the caller.
+#ifndef MICROPY_VM_PROFILE
+#define MICROPY_VM_PROFILE (0)
+#endif
+
+// Number of functions profiled, a power of 2. Later functions are counted
+// together.
+#ifndef MICROPY_VM_PROFILE_FUNCTIONS
+#define MICROPY_VM_PROFILE_FUNCTIONS (64)
+#endif
+
+// Microsecond clock used to time functions.
+#ifndef MICROPY_VM_PROFILE_TICKS_US
+#define MICROPY_VM_PROFILE_TICKS_US() mp_hal_ticks_us()
+#endif
+
 // Don't use alloca calls. As alloca() is not part of ANSI C, this
 // workaround option is provided for compilers lacking this de-facto
 // standard function. The way it works is allocating from heap, and
@@ -252,6 +270,53 @@
 #define MICROPY_ATB_INDICES (8)
 #endif
 
+// Number of free runs to remember for each small allocation size. The sweep
+// records where runs of 1 to MICROPY_GC_FREE_LIST_CLASSES free blocks start
+// so that short lived allocations of that size don't need to scan the ATB.
+// Each entry costs a size_t per size class. Set to 0 to disable.
+#ifndef MICROPY_GC_FREE_LIST_LEN
+#define MICROPY_GC_FREE_LIST_LEN (0)
+#endif
+
+// Largest allocation, in blocks, served from the free lists.
+#ifndef MICROPY_GC_FREE_LIST_CLASSES
+#define MICROPY_GC_FREE_LIST_CLASSES (4)
+#endif
+
+// Whether an allocation that fails after a collection first tries to make room
+// by sliding data in the long lived section up to the end of the heap. Only
+// the buffers behind str, bytes, function and dict objects and the qstr pools
+// and chunks are moved, and only when the fields pointing to them are the sole
+// references found. Pointers into the heap kept outside of it must be passed
+// to gc_collect_root or gc_collect_ptr during a collection or the buffers they
+// reach may move, so a port must be checked for these before enabling it.
+#ifndef MICROPY_GC_COMPACT
+#define MICROPY_GC_COMPACT (0)
+#endif
+
+// Most buffer references a single compaction considers.
+#ifndef MICROPY_GC_COMPACT_ENTRIES
+#define MICROPY_GC_COMPACT_ENTRIES (256)
+#endif
+
+// Whether to count the allocations made from each call site and time the
+// collections, for micropython.alloc_profile() and gc.stats(). A call site is
+// the line of the innermost running bytecode function or, outside of one, the
+// address gc_alloc was called from.
+#ifndef MICROPY_GC_PROFILE
+#define MICROPY_GC_PROFILE (0)
+#endif
+
+// Number of call sites profiled. Later sites are counted together.
+#ifndef MICROPY_GC_PROFILE_SITES
+#define MICROPY_GC_PROFILE_SITES (32)
+#endif
+
+// Microsecond clock used to time collections.
+#ifndef MICROPY_GC_PROFILE_TICKS_US
+#define MICROPY_GC_PROFILE_TICKS_US() mp_hal_ticks_us()
+#endif
+
 /*****************************************************************************/
 /* MicroPython emitters                                                     */
 
@@ -420,6 +485,21 @@
 #define MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE (0)
 #endif
 
+// Whether to cache the results of looking up attributes of instances in their
+// class and its bases, keyed on the type and attribute.  The cache is global so
+// it also works for bytecode in ROM, and is invalidated as a whole whenever a
+// class is created or has an attribute stored or deleted.  Uses
+// MICROPY_OPT_CACHE_CLASS_LOOKUP_SIZE * 4 words of RAM.  The cache is shared by
+// all threads so requires the GIL if threading is enabled.
+#ifndef MICROPY_OPT_CACHE_CLASS_LOOKUP
+#define MICROPY_OPT_CACHE_CLASS_LOOKUP (0)
+#endif
+
+// Number of entries in the class lookup cache, must be a power of 2.
+#ifndef MICROPY_OPT_CACHE_CLASS_LOOKUP_SIZE
+#define MICROPY_OPT_CACHE_CLASS_LOOKUP_SIZE (64)
+#endif
+
 // Whether to use fast versions of bitwise operations (and, or, xor) when the
 // arguments are both positive.  Increases Thumb2 code size by about 250 bytes.
 #ifndef MICROPY_OPT_MPZ_BITWISE
@@ -60,6 +60,43 @@ typedef struct _mp_sched_item_t {
     mp_obj_t arg;
 } mp_sched_item_t;
 
+#if MICROPY_OPT_CACHE_CLASS_LOOKUP
+// Where an attribute of instances of a type was found in the class hierarchy.
+typedef struct _mp_class_lookup_cache_t {
+    const mp_obj_type_t *type;
+    qstr attr;
+    size_t version; // the cache version the entry was stored with
+    const mp_obj_type_t *found_type; // the type whose locals_dict has the attribute
+    mp_obj_t value;
+} mp_class_lookup_cache_t;
+#endif
+
+#if MICROPY_VM_PROFILE
+// Calls into and time spent in one bytecode function.
+typedef struct _mp_vm_profile_function_t {
+    const byte *bytecode; // NULL for a free entry, or the entry for the rest
+    qstr block_name;
+    qstr source_file;
+    size_t line;
+    size_t calls;
+    mp_uint_t time; // including the functions it calls
+    mp_uint_t start;
+    size_t depth; // number of calls running, for recursive functions
+} mp_vm_profile_function_t;
+#endif
+
+#if MICROPY_GC_PROFILE
+// Allocations made from one call site.
+typedef struct _gc_profile_site_t {
+    const void *key; // the opcode or native code making the allocation
+    qstr block_name; // MP_QSTR_NULL for native code
+    qstr source_file;
+    size_t line;
+    size_t count;
+    size_t bytes;
+} gc_profile_site_t;
+#endif
+
 // This structure hold information about the memory allocation system.
 typedef struct _mp_state_mem_t {
     #if MICROPY_MEM_STATS
@@ -95,6 +132,32 @@ typedef struct _mp_state_mem_t {
     size_t gc_first_free_atb_index[MICROPY_ATB_INDICES];
     size_t gc_last_free_atb_index;
 
+    #if MICROPY_GC_FREE_LIST_LEN
+    // Start blocks of free runs below the long lived section, one stack per
+    // size class. Entries may go stale and are checked against the ATB on use.
+    size_t gc_free_list[MICROPY_GC_FREE_LIST_CLASSES][MICROPY_GC_FREE_LIST_LEN];
+    uint16_t gc_free_list_count[MICROPY_GC_FREE_LIST_CLASSES];
+    #endif
+
+    #if MICROPY_GC_COMPACT
+    // References counted by the collection a compaction runs, or NULL.
+    void *gc_compact_table;
+    size_t gc_compact_len;
+    bool gc_compacting;
+    #endif
+
+    #if MICROPY_GC_PROFILE
+    gc_profile_site_t gc_profile_sites[MICROPY_GC_PROFILE_SITES];
+    size_t gc_profile_n_sites;
+    // Allocations from sites that didn't fit in the table.
+    size_t gc_profile_other_count;
+    size_t gc_profile_other_bytes;
+    size_t gc_profile_collections;
+    mp_uint_t gc_profile_collect_start;
+    mp_uint_t gc_profile_pause_total;
+    mp_uint_t gc_profile_pause_max;
+    #endif
+
     #if MICROPY_PY_GC_COLLECT_RETVAL
     size_t gc_collected;
     #endif
@@ -210,6 +273,21 @@ typedef struct _mp_state_vm_t {
     mp_uint_t mp_optimise_value;
     #endif
 
+    #if MICROPY_OPT_CACHE_CLASS_LOOKUP
+    // Not scanned by the GC: an entry is only used while its version is
+    // current, and then its types and value are still in use by the classes.
+    size_t class_lookup_version;
+    mp_class_lookup_cache_t class_lookup_cache[MICROPY_OPT_CACHE_CLASS_LOOKUP_SIZE];
+    #endif
+
+    #if MICROPY_VM_PROFILE
+    mp_uint_t vm_profile_opcodes[256];
+    // A hash table of functions by bytecode, then the entry for the rest.
+    mp_vm_profile_function_t vm_profile_functions[MICROPY_VM_PROFILE_FUNCTIONS + 1];
+    // Changed by a reset, so calls running at the time aren't counted.
+    size_t vm_profile_generation;
+    #endif
+
     // size of the emergency exception buf, if it's dynamically allocated
     #if MICROPY_ENABLE_EMERGENCY_EXCEPTION_BUF && MICROPY_EMERGENCY_EXCEPTION_BUF_SIZE == 0
     mp_int_t mp_emergency_exception_buf_size;
@@ -246,6 +324,11 @@ typedef struct _mp_state_thread_t {
     uint8_t *pystack_cur;
     #endif
 
+    #if MICROPY_GC_PROFILE
+    // The innermost running bytecode function, to attribute allocations to.
+    struct _mp_code_state_t *current_code_state;
+    #endif
+
     ////////////////////////////////////////////////////////////
     // START ROOT POINTER SECTION
     // Everything that needs GC scanning must start here, and
@@ -283,7 +283,14 @@ STATIC mp_obj_t PLACE_IN_ITCM(fun_bc_call)(mp_obj_t self_in, size_t n_args, size
 
     // execute the byte code with the correct globals context
     mp_globals_set(self->globals);
+    #if MICROPY_GC_PROFILE
+    mp_code_state_t *old_code_state = MP_STATE_THREAD(current_code_state);
+    MP_STATE_THREAD(current_code_state) = code_state;
+    #endif
     mp_vm_return_kind_t vm_return_kind = mp_execute_bytecode(code_state, MP_OBJ_NULL);
+    #if MICROPY_GC_PROFILE
+    MP_STATE_THREAD(current_code_state) = old_code_state;
+    #endif
     mp_globals_set(code_state->old_globals);
 
 #if VM_DETECT_STACK_OVERFLOW
@@ -130,7 +130,14 @@ mp_vm_return_kind_t mp_obj_gen_resume(mp_obj_t self_in, mp_obj_t send_value, mp_
     self->code_state.old_globals = mp_globals_get();
     mp_globals_set(self->globals);
     self->globals = NULL;
+    #if MICROPY_GC_PROFILE
+    mp_code_state_t *old_code_state = MP_STATE_THREAD(current_code_state);
+    MP_STATE_THREAD(current_code_state) = &self->code_state;
+    #endif
     mp_vm_return_kind_t ret_kind = mp_execute_bytecode(&self->code_state, throw_value);
+    #if MICROPY_GC_PROFILE
+    MP_STATE_THREAD(current_code_state) = old_code_state;
+    #endif
     self->globals = mp_globals_get();
     mp_globals_set(self->code_state.old_globals);
 
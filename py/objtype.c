@@ -148,6 +148,13 @@ struct class_lookup_data {
     size_t meth_offset;
     mp_obj_t *dest;
     bool is_type;
+    #if MICROPY_OPT_CACHE_CLASS_LOOKUP
+    // set if the attribute was found in a locals_dict, so can be cached
+    const mp_obj_type_t *found_type;
+    mp_obj_t found_value;
+    // set if a native base was asked for the attribute on the way
+    bool native_attr;
+    #endif
 };
 
 STATIC void mp_obj_class_lookup(struct class_lookup_data  *lookup, const mp_obj_type_t *type) {
@@ -177,6 +184,10 @@ STATIC void mp_obj_class_lookup(struct class_lookup_data  *lookup, const mp_obj_
             mp_map_t *locals_map = &type->locals_dict->map;
             mp_map_elem_t *elem = mp_map_lookup(locals_map, MP_OBJ_NEW_QSTR(lookup->attr), MP_MAP_LOOKUP);
             if (elem != NULL) {
+                #if MICROPY_OPT_CACHE_CLASS_LOOKUP
+                lookup->found_type = type;
+                lookup->found_value = elem->value;
+                #endif
                 if (lookup->is_type) {
                     // If we look up a class method, we need to return original type for which we
                     // do a lookup, not a (base) type in which we found the class method.
@@ -203,6 +214,9 @@ STATIC void mp_obj_class_lookup(struct class_lookup_data  *lookup, const mp_obj_
         // but some attributes of native types may be handled using .load_attr method,
         // so make sure we try to lookup those too.
         if (lookup->obj != NULL && !lookup->is_type && mp_obj_is_native_type(type) && type != &mp_type_object /* object is not a real type */) {
+            #if MICROPY_OPT_CACHE_CLASS_LOOKUP
+            lookup->native_attr = true;
+            #endif
             mp_load_method_maybe(lookup->obj->subobj[0], lookup->attr, lookup->dest);
             if (lookup->dest[0] != MP_OBJ_NULL) {
                 return;
@@ -246,6 +260,49 @@ STATIC void mp_obj_class_lookup(struct class_lookup_data  *lookup, const mp_obj_
     }
 }
 
+#if MICROPY_OPT_CACHE_CLASS_LOOKUP
+STATIC mp_class_lookup_cache_t *class_lookup_cache_entry(const mp_obj_type_t *type, qstr attr) {
+    size_t i = ((uintptr_t)type >> 3) ^ (attr * 7);
+    return &MP_STATE_VM(class_lookup_cache)[i & (MICROPY_OPT_CACHE_CLASS_LOOKUP_SIZE - 1)];
+}
+
+// Called whenever an entry may have become wrong: when a class has an
+// attribute stored or deleted, and when a class is created (it may take the
+// place in the heap of a class that was freed).
+STATIC void class_lookup_cache_invalidate(void) {
+    if (++MP_STATE_VM(class_lookup_version) == 0) {
+        // Wrapped around, so old entries could look current again.
+        memset(MP_STATE_VM(class_lookup_cache), 0, sizeof(MP_STATE_VM(class_lookup_cache)));
+    }
+}
+
+// As mp_obj_class_lookup for an instance attribute, using the cache.
+STATIC void instance_class_lookup(struct class_lookup_data *lookup, const mp_obj_type_t *type) {
+    mp_class_lookup_cache_t *entry = class_lookup_cache_entry(type, lookup->attr);
+    if (entry->type == type && entry->attr == lookup->attr
+        && entry->version == MP_STATE_VM(class_lookup_version)) {
+        if (MP_OBJ_IS_TYPE(entry->value, &mp_type_property)) {
+            lookup->dest[0] = entry->value;
+        } else {
+            mp_convert_member_lookup(MP_OBJ_FROM_PTR(lookup->obj), entry->found_type, entry->value, lookup->dest);
+        }
+        return;
+    }
+    mp_obj_class_lookup(lookup, type);
+    // Don't cache if a native base's load_attr was tried, as its result may
+    // depend on the native object.
+    if (lookup->found_type != NULL && !lookup->native_attr) {
+        entry->type = type;
+        entry->attr = lookup->attr;
+        entry->version = MP_STATE_VM(class_lookup_version);
+        entry->found_type = lookup->found_type;
+        entry->value = lookup->found_value;
+    }
+}
+#else
+#define instance_class_lookup mp_obj_class_lookup
+#endif
+
 STATIC void instance_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
     mp_obj_instance_t *self = MP_OBJ_TO_PTR(self_in);
     qstr meth = (kind == PRINT_STR) ? MP_QSTR___str__ : MP_QSTR___repr__;
@@ -619,7 +676,7 @@ STATIC void mp_obj_instance_load_attr(mp_obj_t self_in, qstr attr, mp_obj_t *des
         .dest = dest,
         .is_type = false,
     };
-    mp_obj_class_lookup(&lookup, self->base.type);
+    instance_class_lookup(&lookup, self->base.type);
     mp_obj_t member = dest[0];
     if (member != MP_OBJ_NULL) {
         // changes here may may require changes to super_attr, below
@@ -1072,6 +1129,9 @@ STATIC void type_attr(mp_obj_t self_in, qstr attr, mp_obj_t *dest) {
                 // can't apply delete/store to a fixed map
                 return;
             }
+            #if MICROPY_OPT_CACHE_CLASS_LOOKUP
+            class_lookup_cache_invalidate();
+            #endif
             if (dest[1] == MP_OBJ_NULL) {
                 // delete attribute
                 mp_map_elem_t *elem = mp_map_lookup(locals_map, MP_OBJ_NEW_QSTR(attr), MP_MAP_LOOKUP_REMOVE_IF_FOUND);
@@ -1150,6 +1210,9 @@ mp_obj_t mp_obj_new_type(qstr name, mp_obj_t bases_tuple, mp_obj_t locals_dict)
     }
 
     mp_obj_type_t *o = m_new0_ll(mp_obj_type_t, 1);
+    #if MICROPY_OPT_CACHE_CLASS_LOOKUP
+    class_lookup_cache_invalidate();
+    #endif
     o->base.type = &mp_type_type;
     o->flags = base_flags;
     o->name = name;
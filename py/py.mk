@@ -239,6 +239,7 @@ PY_CORE_O_BASENAME = $(addprefix py/,\
 	modstruct.o \
 	modsys.o \
 	moduerrno.o \
+	moduprofile.o \
 	modthread.o \
 	vm.o \
 	bc.o \
@@ -41,6 +41,7 @@
 #include "py/objlist.h"
 #include "py/objmodule.h"
 #include "py/objgenerator.h"
+#include "py/bc.h"
 #include "py/smallint.h"
 #include "py/runtime.h"
 #include "py/builtin.h"
@@ -102,6 +103,11 @@ void mp_init(void) {
     MP_STATE_VM(mp_optimise_value) = 0;
     #endif
 
+    #if MICROPY_VM_PROFILE
+    // start with an empty profile, the functions of an earlier VM are gone
+    mp_vm_profile_reset();
+    #endif
+
     // init global module dict
     mp_obj_dict_init(&MP_STATE_VM(mp_loaded_modules_dict), 3);
 
@@ -401,6 +401,12 @@ const byte *mp_bytecode_print_str(const byte *ip) {
             printf("FOR_ITER " UINT_FMT, (mp_uint_t)(ip + unum - mp_showbc_code_start));
             break;
 
+        case MP_BC_FOR_RANGE:
+            DECODE_ULABEL; // the jump offset if the range is finished
+            printf("FOR_RANGE " UINT_FMT " step=" INT_FMT, (mp_uint_t)(ip + unum - mp_showbc_code_start), (mp_int_t)(int8_t)*ip);
+            ip += 1;
+            break;
+
         case MP_BC_POP_BLOCK:
             // pops block and restores the stack
             printf("POP_BLOCK");
@@ -532,6 +538,21 @@ const byte *mp_bytecode_print_str(const byte *ip) {
             printf("IMPORT_STAR");
             break;
 
+        case MP_BC_LOAD_FAST_FAST_BINARY_OP:
+            unum = ip[0] | ip[1] << 8;
+            ip += 2;
+            printf("LOAD_FAST_FAST_BINARY_OP " UINT_FMT " " UINT_FMT " " UINT_FMT " %s", unum & 0xf,
+                (unum >> 4) & 0xf, unum >> 8, qstr_str(mp_binary_op_method_name[unum >> 8]));
+            break;
+
+        case MP_BC_LOAD_FAST_CONST_BINARY_OP: {
+            unum = ip[0] | ip[1] << 8;
+            ip += 2;
+            printf("LOAD_FAST_CONST_BINARY_OP " UINT_FMT " " INT_FMT " " UINT_FMT " %s", unum & 0xf,
+                (mp_int_t)((unum >> 4) & 0x3f) - 16, unum >> 10, qstr_str(mp_binary_op_method_name[unum >> 10]));
+            break;
+        }
+
         default:
             if (ip[-1] < MP_BC_LOAD_CONST_SMALL_INT_MULTI + 64) {
                 printf("LOAD_CONST_SMALL_INT " INT_FMT, (mp_int_t)ip[-1] - MP_BC_LOAD_CONST_SMALL_INT_MULTI - 16);
@@ -34,15 +34,106 @@
 #include "py/runtime.h"
 #include "py/bc0.h"
 #include "py/bc.h"
+#include "py/smallint.h"
+#if MICROPY_VM_PROFILE
+#include "py/mphal.h"
+#endif
 
 #include "supervisor/linker.h"
 
+// The common cases of a binary op on two small ints, done in line by the fused
+// binary op opcodes.  Returns MP_OBJ_NULL if mp_binary_op is needed.
+static inline mp_obj_t small_int_binary_op(mp_binary_op_t op, mp_obj_t lhs, mp_obj_t rhs) {
+    if (!MP_OBJ_IS_SMALL_INT(lhs) || !MP_OBJ_IS_SMALL_INT(rhs)) {
+        return MP_OBJ_NULL;
+    }
+    mp_int_t lhs_val = MP_OBJ_SMALL_INT_VALUE(lhs);
+    mp_int_t rhs_val = MP_OBJ_SMALL_INT_VALUE(rhs);
+    switch (op) {
+        case MP_BINARY_OP_LESS: return mp_obj_new_bool(lhs_val < rhs_val);
+        case MP_BINARY_OP_MORE: return mp_obj_new_bool(lhs_val > rhs_val);
+        case MP_BINARY_OP_EQUAL: return mp_obj_new_bool(lhs_val == rhs_val);
+        case MP_BINARY_OP_LESS_EQUAL: return mp_obj_new_bool(lhs_val <= rhs_val);
+        case MP_BINARY_OP_MORE_EQUAL: return mp_obj_new_bool(lhs_val >= rhs_val);
+        case MP_BINARY_OP_NOT_EQUAL: return mp_obj_new_bool(lhs_val != rhs_val);
+        case MP_BINARY_OP_ADD:
+        case MP_BINARY_OP_INPLACE_ADD: lhs_val += rhs_val; break;
+        case MP_BINARY_OP_SUBTRACT:
+        case MP_BINARY_OP_INPLACE_SUBTRACT: lhs_val -= rhs_val; break;
+        case MP_BINARY_OP_AND:
+        case MP_BINARY_OP_INPLACE_AND: return MP_OBJ_NEW_SMALL_INT(lhs_val & rhs_val);
+        default: return MP_OBJ_NULL;
+    }
+    if (!MP_SMALL_INT_FITS(lhs_val)) {
+        return MP_OBJ_NULL;
+    }
+    return MP_OBJ_NEW_SMALL_INT(lhs_val);
+}
+
 #if 0
 #define TRACE(ip) printf("sp=%d ", (int)(sp - &code_state->state[0] + 1)); mp_bytecode_print2(ip, 1, code_state->fun_bc->const_table);
 #else
 #define TRACE(ip)
 #endif
 
+#if MICROPY_VM_PROFILE
+#define PROFILE_OPCODE(ip) (MP_STATE_VM(vm_profile_opcodes)[*(ip)]++)
+#define PROFILE_EXIT() vm_profile_exit(profile_function, profile_generation)
+
+void mp_vm_profile_reset(void) {
+    memset(MP_STATE_VM(vm_profile_opcodes), 0, sizeof(MP_STATE_VM(vm_profile_opcodes)));
+    memset(MP_STATE_VM(vm_profile_functions), 0, sizeof(MP_STATE_VM(vm_profile_functions)));
+    MP_STATE_VM(vm_profile_generation)++;
+}
+
+// Find or add the entry for the function with the given bytecode.
+STATIC mp_vm_profile_function_t *vm_profile_function(const byte *bytecode) {
+    mp_vm_profile_function_t *functions = MP_STATE_VM(vm_profile_functions);
+    size_t i = ((uintptr_t)bytecode / sizeof(mp_uint_t)) & (MICROPY_VM_PROFILE_FUNCTIONS - 1);
+    for (size_t n = 0; n < MICROPY_VM_PROFILE_FUNCTIONS; n++) {
+        mp_vm_profile_function_t *f = &functions[i];
+        if (f->bytecode == bytecode) {
+            return f;
+        }
+        if (f->bytecode == NULL) {
+            // Look the name up now; the bytecode may be gone by the time the
+            // profile is read. The line is that of the first opcode.
+            const byte *ip = bytecode;
+            ip = mp_decode_uint_skip(ip); // skip n_state
+            ip = mp_decode_uint_skip(ip); // skip n_exc_stack
+            ip += 4; // skip scope_params, n_pos_args, n_kwonly_args, n_def_pos_args
+            ip += mp_decode_uint_value(ip); // skip code_info
+            while (*ip++ != 255) { // skip closed over variables
+            }
+            f->bytecode = bytecode;
+            f->line = mp_bytecode_get_source_line(bytecode, ip, &f->block_name, &f->source_file);
+            return f;
+        }
+        i = (i + 1) & (MICROPY_VM_PROFILE_FUNCTIONS - 1);
+    }
+    return &functions[MICROPY_VM_PROFILE_FUNCTIONS];
+}
+
+STATIC mp_vm_profile_function_t *vm_profile_enter(const mp_code_state_t *code_state) {
+    mp_vm_profile_function_t *f = vm_profile_function(code_state->fun_bc->bytecode);
+    f->calls++;
+    if (f->depth++ == 0) {
+        f->start = MICROPY_VM_PROFILE_TICKS_US();
+    }
+    return f;
+}
+
+STATIC void vm_profile_exit(mp_vm_profile_function_t *f, size_t generation) {
+    // The time of recursive calls is only counted once, by the outermost.
+    if (generation == MP_STATE_VM(vm_profile_generation) && --f->depth == 0) {
+        f->time += MICROPY_VM_PROFILE_TICKS_US() - f->start;
+    }
+}
+#else
+#define PROFILE_OPCODE(ip)
+#define PROFILE_EXIT()
+#endif
+
 // Value stack grows up (this makes it incompatible with native C stack, but
 // makes sure that arguments to functions are in natural order arg1..argN
 // (Python semantics mandates left-to-right evaluation order, including for
@@ -131,6 +222,7 @@ mp_vm_return_kind_t PLACE_IN_ITCM(mp_execute_bytecode)(mp_code_state_t *code_sta
     #include "py/vmentrytable.h"
     #define DISPATCH() do { \
         TRACE(ip); \
+        PROFILE_OPCODE(ip); \
         MARK_EXC_IP_GLOBAL(); \
         goto *entry_table[*ip++]; \
     } while (0)
@@ -150,6 +242,11 @@ mp_vm_return_kind_t PLACE_IN_ITCM(mp_execute_bytecode)(mp_code_state_t *code_sta
     // loop and the exception handler, leading to very obscure bugs.
     #define RAISE(o) do { nlr_pop(); nlr.ret_val = MP_OBJ_TO_PTR(o); goto exception_handler; } while (0)
 
+    #if MICROPY_VM_PROFILE
+    mp_vm_profile_function_t *profile_function = vm_profile_enter(code_state);
+    size_t profile_generation = MP_STATE_VM(vm_profile_generation);
+    #endif
+
 #if MICROPY_STACKLESS
 run_code_state: ;
 #endif
@@ -202,6 +299,7 @@ dispatch_loop:
                 DISPATCH();
 #else
                 TRACE(ip);
+                PROFILE_OPCODE(ip);
                 MARK_EXC_IP_GLOBAL();
                 switch (*ip++) {
 #endif
@@ -763,6 +861,36 @@ unwind_jump:;
                     DISPATCH_WITH_PEND_EXC_CHECK();
                 }
 
+                ENTRY(MP_BC_FOR_RANGE): {
+                    MARK_EXC_IP_SELECTIVE();
+                    DECODE_ULABEL; // the jump offset if the range is finished, from the step byte that follows
+                    mp_int_t step = (int8_t)*ip;
+                    mp_obj_t end = sp[-1];
+                    mp_obj_t value = TOP();
+                    mp_obj_t next;
+                    if (MP_OBJ_IS_SMALL_INT(value) && MP_OBJ_IS_SMALL_INT(end)) {
+                        mp_int_t value_val = MP_OBJ_SMALL_INT_VALUE(value);
+                        mp_int_t end_val = MP_OBJ_SMALL_INT_VALUE(end);
+                        if (step > 0 ? value_val >= end_val : value_val <= end_val) {
+                            ip += ulab; // jump to after for-block
+                            DISPATCH();
+                        }
+                        // a small int plus a byte can't overflow a mp_int_t
+                        next = mp_obj_new_int(value_val + step);
+                    } else {
+                        mp_obj_t in_range = mp_binary_op(step > 0 ? MP_BINARY_OP_LESS : MP_BINARY_OP_MORE, value, end);
+                        if (!mp_obj_is_true(in_range)) {
+                            ip += ulab; // jump to after for-block
+                            DISPATCH();
+                        }
+                        next = mp_binary_op(MP_BINARY_OP_INPLACE_ADD, value, MP_OBJ_NEW_SMALL_INT(step));
+                    }
+                    ip += 1;
+                    SET_TOP(next);
+                    PUSH(value); // push the value for this iteration
+                    DISPATCH();
+                }
+
                 // matched against: SETUP_EXCEPT, SETUP_FINALLY, SETUP_WITH
                 ENTRY(MP_BC_POP_BLOCK):
                     // we are exiting an exception handler, so pop the last one of the exception-stack
@@ -1120,6 +1248,7 @@ unwind_return:
                         goto run_code_state;
                     }
                     #endif
+                    PROFILE_EXIT();
                     return MP_VM_RETURN_NORMAL;
 
                 ENTRY(MP_BC_RAISE_VARARGS): {
@@ -1157,6 +1286,7 @@ yield:
                     code_state->ip = ip;
                     code_state->sp = sp;
                     code_state->exc_sp = MP_TAGPTR_MAKE(exc_sp, currently_in_except_block);
+                    PROFILE_EXIT();
                     return MP_VM_RETURN_YIELD;
 
                 ENTRY(MP_BC_YIELD_FROM): {
@@ -1233,6 +1363,41 @@ yield:
                     mp_import_all(POP());
                     DISPATCH();
 
+                ENTRY(MP_BC_LOAD_FAST_FAST_BINARY_OP): {
+                    MARK_EXC_IP_SELECTIVE();
+                    mp_obj_t lhs = fastn[-(mp_int_t)(ip[0] & 0xf)];
+                    mp_obj_t rhs = fastn[-(mp_int_t)(ip[0] >> 4)];
+                    mp_binary_op_t op = ip[1];
+                    ip += 2;
+                    if (lhs == MP_OBJ_NULL || rhs == MP_OBJ_NULL) {
+                        goto local_name_error;
+                    }
+                    mp_obj_t res = small_int_binary_op(op, lhs, rhs);
+                    if (res == MP_OBJ_NULL) {
+                        res = mp_binary_op(op, lhs, rhs);
+                    }
+                    PUSH(res);
+                    DISPATCH();
+                }
+
+                ENTRY(MP_BC_LOAD_FAST_CONST_BINARY_OP): {
+                    MARK_EXC_IP_SELECTIVE();
+                    size_t arg = ip[0] | ip[1] << 8;
+                    ip += 2;
+                    mp_obj_t lhs = fastn[-(mp_int_t)(arg & 0xf)];
+                    mp_obj_t rhs = MP_OBJ_NEW_SMALL_INT((mp_int_t)((arg >> 4) & 0x3f) - 16);
+                    mp_binary_op_t op = arg >> 10;
+                    if (lhs == MP_OBJ_NULL) {
+                        goto local_name_error;
+                    }
+                    mp_obj_t res = small_int_binary_op(op, lhs, rhs);
+                    if (res == MP_OBJ_NULL) {
+                        res = mp_binary_op(op, lhs, rhs);
+                    }
+                    PUSH(res);
+                    DISPATCH();
+                }
+
 #if MICROPY_OPT_COMPUTED_GOTO
                 ENTRY(MP_BC_LOAD_CONST_SMALL_INT_MULTI):
                     PUSH(MP_OBJ_NEW_SMALL_INT((mp_int_t)ip[-1] - MP_BC_LOAD_CONST_SMALL_INT_MULTI - 16));
@@ -1286,6 +1451,7 @@ yield:
                     mp_obj_t obj = mp_obj_new_exception_msg(&mp_type_NotImplementedError, translate("byte code not implemented"));
                     nlr_pop();
                     fastn[0] = obj;
+                    PROFILE_EXIT();
                     return MP_VM_RETURN_EXCEPTION;
                 }
 
@@ -1383,50 +1549,9 @@ unwind_loop:
             // TODO: don't set traceback for exceptions re-raised by END_FINALLY.
             // But consider how to handle nested exceptions.
             if (nlr.ret_val != &mp_const_GeneratorExit_obj) {
-                const byte *ip = code_state->fun_bc->bytecode;
-                ip = mp_decode_uint_skip(ip); // skip n_state
-                ip = mp_decode_uint_skip(ip); // skip n_exc_stack
-                ip++; // skip scope_params
-                ip++; // skip n_pos_args
-                ip++; // skip n_kwonly_args
-                ip++; // skip n_def_pos_args
-                size_t bc = code_state->ip - ip;
-                size_t code_info_size = mp_decode_uint_value(ip);
-                ip = mp_decode_uint_skip(ip); // skip code_info_size
-                bc -= code_info_size;
-                #if MICROPY_PERSISTENT_CODE
-                qstr block_name = ip[0] | (ip[1] << 8);
-                qstr source_file = ip[2] | (ip[3] << 8);
-                ip += 4;
-                #else
-                qstr block_name = mp_decode_uint_value(ip);
-                ip = mp_decode_uint_skip(ip);
-                qstr source_file = mp_decode_uint_value(ip);
-                ip = mp_decode_uint_skip(ip);
-                #endif
-                size_t source_line = 1;
-                size_t c;
-                while ((c = *ip)) {
-                    size_t b, l;
-                    if ((c & 0x80) == 0) {
-                        // 0b0LLBBBBB encoding
-                        b = c & 0x1f;
-                        l = c >> 5;
-                        ip += 1;
-                    } else {
-                        // 0b1LLLBBBB 0bLLLLLLLL encoding (l's LSB in second byte)
-                        b = c & 0xf;
-                        l = ((c << 4) & 0x700) | ip[1];
-                        ip += 2;
-                    }
-                    if (bc >= b) {
-                        bc -= b;
-                        source_line += l;
-                    } else {
-                        // found source line corresponding to bytecode offset
-                        break;
-                    }
-                }
+                qstr block_name;
+                qstr source_file;
+                size_t source_line = mp_bytecode_get_source_line(code_state->fun_bc->bytecode, code_state->ip, &block_name, &source_file);
                 mp_obj_exception_add_traceback(MP_OBJ_FROM_PTR(nlr.ret_val), source_file, source_line, block_name);
             }
 
@@ -1480,6 +1605,7 @@ unwind_loop:
                 // propagate exception to higher level
                 // TODO what to do about ip and sp? they don't really make sense at this point
                 fastn[0] = MP_OBJ_FROM_PTR(nlr.ret_val); // must put exception here because sp is invalid
+                PROFILE_EXIT();
                 return MP_VM_RETURN_EXCEPTION;
             }
         }
@@ -77,7 +77,10 @@ static const void *const PLACE_IN_DTCM_DATA(entry_table[256]) = {
     [MP_BC_END_FINALLY] = &&entry_MP_BC_END_FINALLY,
     [MP_BC_GET_ITER] = &&entry_MP_BC_GET_ITER,
     [MP_BC_GET_ITER_STACK] = &&entry_MP_BC_GET_ITER_STACK,
+    [MP_BC_LOAD_FAST_FAST_BINARY_OP] = &&entry_MP_BC_LOAD_FAST_FAST_BINARY_OP,
+    [MP_BC_LOAD_FAST_CONST_BINARY_OP] = &&entry_MP_BC_LOAD_FAST_CONST_BINARY_OP,
     [MP_BC_FOR_ITER] = &&entry_MP_BC_FOR_ITER,
+    [MP_BC_FOR_RANGE] = &&entry_MP_BC_FOR_RANGE,
     [MP_BC_POP_BLOCK] = &&entry_MP_BC_POP_BLOCK,
     [MP_BC_POP_EXCEPT] = &&entry_MP_BC_POP_EXCEPT,
     [MP_BC_BUILD_TUPLE] = &&entry_MP_BC_BUILD_TUPLE,
@@ -0,0 +1,254 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+
+#include "lib/utils/context_manager_helpers.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/util.h"
+#include "shared-bindings/audiocore/SampleQueue.h"
+#include "supervisor/shared/translate.h"
+
+//| class SampleQueue:
+//|     """A queue of audio samples written from Python while it plays"""
+//|
+//|     def __init__(self, *, sample_rate: int = 8000, channel_count: int = 1, bits_per_sample: int = 16, buffer_size: int = 4096):
+//|         """Create an empty queue to stream samples generated or received while playing. Samples
+//|         are in the same format as a `WaveFile`: 8 bit samples are unsigned, 16 bit samples are
+//|         signed and the channels of each frame alternate.
+//|
+//|         Silence is played while the queue is empty so playback continues until it is stopped.
+//|
+//|         :param int sample_rate: The desired playback sample rate
+//|         :param int channel_count: The number of channels. 1 = mono; 2 = stereo.
+//|         :param int bits_per_sample: The bits per sample, 8 or 16
+//|         :param int buffer_size: Bytes of samples the queue can hold, at least 64. Around an eighth
+//|           is handed to the output at a time.
+//|
+//|         Playing a tone generated as it plays::
+//|
+//|           import array
+//|           import audiocore
+//|           import audioio
+//|           import board
+//|           import math
+//|
+//|           length = 8000 // 440
+//|           sine_wave = array.array("h", [0] * length)
+//|           for i in range(length):
+//|               sine_wave[i] = int(math.sin(math.pi * 2 * i / length) * (2 ** 14))
+//|
+//|           queue = audiocore.SampleQueue(sample_rate=8000)
+//|           dac = audioio.AudioOut(board.SPEAKER)
+//|           dac.play(queue)
+//|           pending = memoryview(sine_wave)
+//|           while True:
+//|               written = queue.write(pending)
+//|               pending = pending[written // 2:]
+//|               if not pending:
+//|                   pending = memoryview(sine_wave)"""
+//|         ...
+//|
+STATIC mp_obj_t audioio_samplequeue_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_sample_rate, ARG_channel_count, ARG_bits_per_sample, ARG_buffer_size };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sample_rate, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 8000} },
+        { MP_QSTR_channel_count, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1} },
+        { MP_QSTR_bits_per_sample, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 16} },
+        { MP_QSTR_buffer_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 4096} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t sample_rate = args[ARG_sample_rate].u_int;
+    if (sample_rate < 1) {
+        mp_raise_ValueError(translate("Sample rate must be positive"));
+    }
+    mp_int_t channel_count = args[ARG_channel_count].u_int;
+    if (channel_count < 1 || channel_count > 2) {
+        mp_raise_ValueError(translate("Invalid channel count"));
+    }
+    mp_int_t bits_per_sample = args[ARG_bits_per_sample].u_int;
+    if (bits_per_sample != 8 && bits_per_sample != 16) {
+        mp_raise_ValueError(translate("bits_per_sample must be 8 or 16"));
+    }
+    mp_int_t buffer_size = args[ARG_buffer_size].u_int;
+    if (buffer_size < 64) {
+        mp_raise_ValueError_varg(translate("%q out of range"), MP_QSTR_buffer_size);
+    }
+
+    audioio_samplequeue_obj_t *self = m_new_obj(audioio_samplequeue_obj_t);
+    self->base.type = &audioio_samplequeue_type;
+    common_hal_audioio_samplequeue_construct(self, buffer_size, bits_per_sample, channel_count,
+                                             sample_rate);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def deinit(self, ) -> Any:
+//|         """Deinitialises the SampleQueue and releases any hardware resources for reuse."""
+//|         ...
+//|
+STATIC mp_obj_t audioio_samplequeue_deinit(mp_obj_t self_in) {
+    audioio_samplequeue_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_audioio_samplequeue_deinit(self);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(audioio_samplequeue_deinit_obj, audioio_samplequeue_deinit);
+
+STATIC void check_for_deinit(audioio_samplequeue_obj_t *self) {
+    if (common_hal_audioio_samplequeue_deinited(self)) {
+        raise_deinited_error();
+    }
+}
+
+//|     def __enter__(self, ) -> Any:
+//|         """No-op used by Context Managers."""
+//|         ...
+//|
+//  Provided by context manager helper.
+
+//|     def __exit__(self, ) -> Any:
+//|         """Automatically deinitializes the hardware when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+//|
+STATIC mp_obj_t audioio_samplequeue_obj___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    common_hal_audioio_samplequeue_deinit(args[0]);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(audioio_samplequeue___exit___obj, 4, 4, audioio_samplequeue_obj___exit__);
+
+//|     def write(self, buf: ReadableBuffer) -> int:
+//|         """Add as many whole frames from ``buf`` to the queue as there is room for without
+//|         waiting. Pass the rest again later.
+//|
+//|         :return: the number of bytes added
+//|         :rtype: int"""
+//|         ...
+//|
+STATIC mp_obj_t audioio_samplequeue_write(mp_obj_t self_in, mp_obj_t buf_in) {
+    audioio_samplequeue_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buf_in, &bufinfo, MP_BUFFER_READ);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_audioio_samplequeue_write(self, bufinfo.buf, bufinfo.len));
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audioio_samplequeue_write_obj, audioio_samplequeue_write);
+
+//|     level: int = ...
+//|     """Number of bytes in the queue that have not been handed to the output yet. (read only)"""
+//|
+STATIC mp_obj_t audioio_samplequeue_obj_get_level(mp_obj_t self_in) {
+    audioio_samplequeue_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_audioio_samplequeue_get_level(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioio_samplequeue_get_level_obj, audioio_samplequeue_obj_get_level);
+
+const mp_obj_property_t audioio_samplequeue_level_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&audioio_samplequeue_get_level_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|     underruns: int = ...
+//|     """Number of times the queue ran empty while playing and silence was played instead.
+//|     (read only)"""
+//|
+STATIC mp_obj_t audioio_samplequeue_obj_get_underruns(mp_obj_t self_in) {
+    audioio_samplequeue_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_audioio_samplequeue_get_underruns(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioio_samplequeue_get_underruns_obj, audioio_samplequeue_obj_get_underruns);
+
+const mp_obj_property_t audioio_samplequeue_underruns_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&audioio_samplequeue_get_underruns_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|     sample_rate: Any = ...
+//|     """32 bit value that dictates how quickly samples are played in Hertz (cycles per second).
+//|     This will not change the sample rate of any active playback. Call ``play`` again to
+//|     change it."""
+//|
+STATIC mp_obj_t audioio_samplequeue_obj_get_sample_rate(mp_obj_t self_in) {
+    audioio_samplequeue_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_audioio_samplequeue_get_sample_rate(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioio_samplequeue_get_sample_rate_obj, audioio_samplequeue_obj_get_sample_rate);
+
+STATIC mp_obj_t audioio_samplequeue_obj_set_sample_rate(mp_obj_t self_in, mp_obj_t sample_rate) {
+    audioio_samplequeue_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_audioio_samplequeue_set_sample_rate(self, mp_obj_get_int(sample_rate));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audioio_samplequeue_set_sample_rate_obj, audioio_samplequeue_obj_set_sample_rate);
+
+const mp_obj_property_t audioio_samplequeue_sample_rate_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&audioio_samplequeue_get_sample_rate_obj,
+              (mp_obj_t)&audioio_samplequeue_set_sample_rate_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+STATIC const mp_rom_map_elem_t audioio_samplequeue_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audioio_samplequeue_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&audioio_samplequeue___exit___obj) },
+    { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&audioio_samplequeue_write_obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_level), MP_ROM_PTR(&audioio_samplequeue_level_obj) },
+    { MP_ROM_QSTR(MP_QSTR_underruns), MP_ROM_PTR(&audioio_samplequeue_underruns_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sample_rate), MP_ROM_PTR(&audioio_samplequeue_sample_rate_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(audioio_samplequeue_locals_dict, audioio_samplequeue_locals_dict_table);
+
+STATIC const audiosample_p_t audioio_samplequeue_proto = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_audiosample)
+    .sample_rate = (audiosample_sample_rate_fun)common_hal_audioio_samplequeue_get_sample_rate,
+    .bits_per_sample = (audiosample_bits_per_sample_fun)common_hal_audioio_samplequeue_get_bits_per_sample,
+    .channel_count = (audiosample_channel_count_fun)common_hal_audioio_samplequeue_get_channel_count,
+    .reset_buffer = (audiosample_reset_buffer_fun)audioio_samplequeue_reset_buffer,
+    .get_buffer = (audiosample_get_buffer_fun)audioio_samplequeue_get_buffer,
+    .get_buffer_structure = (audiosample_get_buffer_structure_fun)audioio_samplequeue_get_buffer_structure,
+};
+
+const mp_obj_type_t audioio_samplequeue_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_SampleQueue,
+    .make_new = audioio_samplequeue_make_new,
+    .locals_dict = (mp_obj_dict_t*)&audioio_samplequeue_locals_dict,
+    .protocol = &audioio_samplequeue_proto,
+};
@@ -38,13 +38,25 @@
 //|
 //|     A .wav file prepped for audio playback. Only mono and stereo files are supported. Samples must
 //|     be 8 bit unsigned or 16 bit signed. If a buffer is provided, it will be used instead of allocating
-//|     an internal buffer."""
+//|     an internal buffer.
 //|
-//|     def __init__(self, file: typing.BinaryIO, buffer: bytearray):
+//|     With ``play_from_flash``, a file on a CIRCUITPY drive that the CPU can read directly, such as
+//|     one in internal flash, is played straight from flash and no buffers are used."""
+//|
+//|     def __init__(self, file: typing.BinaryIO, buffer: bytearray, *, buffer_count: int = 2, play_from_flash: bool = False):
 //|         """Load a .wav file for playback with `audioio.AudioOut` or `audiobusio.I2SOut`.
 //|
 //|         :param typing.BinaryIO file: Already opened wave file
-//|         :param bytearray buffer: Optional pre-allocated buffer, that will be split in half and used for double-buffering of the data. If not provided, two 512 byte buffers are allocated internally.
+//|         :param bytearray buffer: Optional pre-allocated buffer, that will be split into ``buffer_count`` buffers for the data. If not provided, ``buffer_count`` 256 byte buffers are allocated internally.
+//|         :param int buffer_count: Number of buffers, from 2 to 8. One buffer plays while the next is
+//|           loaded, and a third is kept back for stereo played on two DMA channels. Any others are
+//|           read from the file ahead of time in the background so that slow storage, such as an SD
+//|           card, doesn't cause gaps in the audio. See `underruns`.
+//|         :param bool play_from_flash: Play the samples straight from flash when the file is on a
+//|           drive the CPU can read directly, instead of copying them into buffers. The file is
+//|           read from wherever it was stored when the WaveFile was made, so it must not be changed,
+//|           moved or deleted while the WaveFile is in use, including from a computer over USB.
+//|           ``buffer`` and ``buffer_count`` are ignored when the file can be played this way.
 //|
 //|
 //|         Playing a wave file from flash::
@@ -69,24 +81,42 @@
 //|           print("stopped")"""
 //|         ...
 //|
-STATIC mp_obj_t audioio_wavefile_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *args, mp_map_t *kw_args) {
-    mp_arg_check_num(n_args, kw_args, 1, 2, false);
+STATIC mp_obj_t audioio_wavefile_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_file, ARG_buffer, ARG_buffer_count, ARG_play_from_flash };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_file, MP_ARG_OBJ | MP_ARG_REQUIRED },
+        { MP_QSTR_buffer, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_buffer_count, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 2} },
+        { MP_QSTR_play_from_flash, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
-    audioio_wavefile_obj_t *self = m_new_obj(audioio_wavefile_obj_t);
-    self->base.type = &audioio_wavefile_type;
-    if (!MP_OBJ_IS_TYPE(args[0], &mp_type_fileio)) {
+    if (!MP_OBJ_IS_TYPE(args[ARG_file].u_obj, &mp_type_fileio)) {
         mp_raise_TypeError(translate("file must be a file opened in byte mode"));
     }
+    mp_int_t buffer_count = args[ARG_buffer_count].u_int;
+    if (buffer_count < 2 || buffer_count > AUDIOIO_WAVEFILE_MAX_BUFFERS) {
+        mp_raise_ValueError_varg(translate("%q out of range"), MP_QSTR_buffer_count);
+    }
     uint8_t *buffer = NULL;
     size_t buffer_size = 0;
-    if (n_args >= 2) {
+    if (args[ARG_buffer].u_obj != mp_const_none) {
         mp_buffer_info_t bufinfo;
-        mp_get_buffer_raise(args[1], &bufinfo, MP_BUFFER_WRITE);
+        mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_WRITE);
+        // Each buffer must hold at least a word.
+        if (bufinfo.len / buffer_count < sizeof(uint32_t)) {
+            mp_raise_ValueError(translate("buffer too small"));
+        }
         buffer = bufinfo.buf;
         buffer_size = bufinfo.len;
     }
-    common_hal_audioio_wavefile_construct(self, MP_OBJ_TO_PTR(args[0]),
-                                          buffer, buffer_size);
+
+    audioio_wavefile_obj_t *self = m_new_obj(audioio_wavefile_obj_t);
+    self->base.type = &audioio_wavefile_type;
+    common_hal_audioio_wavefile_construct(self, MP_OBJ_TO_PTR(args[ARG_file].u_obj),
+                                          buffer, buffer_size, buffer_count,
+                                          args[ARG_play_from_flash].u_bool);
 
     return MP_OBJ_FROM_PTR(self);
 }
@@ -185,6 +215,24 @@ const mp_obj_property_t audioio_wavefile_channel_count_obj = {
               (mp_obj_t)&mp_const_none_obj},
 };
 
+//|     underruns: int = ...
+//|     """Number of buffers that had to be read from the file as they were needed because the
+//|     background read ahead hadn't got to them. Increase ``buffer_count`` if this goes up while
+//|     playing. Every buffer is counted when ``buffer_count`` is 2 or 3. (read only)"""
+//|
+STATIC mp_obj_t audioio_wavefile_obj_get_underruns(mp_obj_t self_in) {
+    audioio_wavefile_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_audioio_wavefile_get_underruns(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioio_wavefile_get_underruns_obj, audioio_wavefile_obj_get_underruns);
+
+const mp_obj_property_t audioio_wavefile_underruns_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&audioio_wavefile_get_underruns_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
 
 STATIC const mp_rom_map_elem_t audioio_wavefile_locals_dict_table[] = {
     // Methods
@@ -196,6 +244,7 @@ STATIC const mp_rom_map_elem_t audioio_wavefile_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_sample_rate), MP_ROM_PTR(&audioio_wavefile_sample_rate_obj) },
     { MP_ROM_QSTR(MP_QSTR_bits_per_sample), MP_ROM_PTR(&audioio_wavefile_bits_per_sample_obj) },
     { MP_ROM_QSTR(MP_QSTR_channel_count), MP_ROM_PTR(&audioio_wavefile_channel_count_obj) },
+    { MP_ROM_QSTR(MP_QSTR_underruns), MP_ROM_PTR(&audioio_wavefile_underruns_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(audioio_wavefile_locals_dict, audioio_wavefile_locals_dict_table);
 
@@ -207,6 +256,7 @@ STATIC const audiosample_p_t audioio_wavefile_proto = {
     .reset_buffer = (audiosample_reset_buffer_fun)audioio_wavefile_reset_buffer,
     .get_buffer = (audiosample_get_buffer_fun)audioio_wavefile_get_buffer,
     .get_buffer_structure = (audiosample_get_buffer_structure_fun)audioio_wavefile_get_buffer_structure,
+    .prefetch = (audiosample_prefetch_fun)audioio_wavefile_prefetch,
 };
 
 
@@ -0,0 +1,394 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "shared-bindings/audiomixer/Effects.h"
+
+#include <stdint.h>
+
+#include "lib/utils/context_manager_helpers.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/util.h"
+#include "supervisor/shared/translate.h"
+
+//| class Effects:
+//|     """Applies gain, filtering, delay and limiting to an audio sample as it plays."""
+//|
+//|     def __init__(self, sample: Any, *, buffer_size: int = 1024, max_delay: int = 0):
+//|         """Create an Effects object that wraps another audio sample. It plays the sample's
+//|         frames at the same sample rate and channel count, as signed 16 bit samples, through
+//|         each effect that is turned on, in order: gain, filter, delay and limit.
+//|
+//|         The effects use fixed point arithmetic on blocks of samples so they are cheap
+//|         enough to run in the audio interrupt.
+//|
+//|         :param sample: The `audiocore.WaveFile`, `audiocore.RawSample`, `audiomixer.Mixer` or other sample to process
+//|         :param int buffer_size: The total size in bytes of the buffers to process into
+//|         :param int max_delay: The longest `delay` in frames. Memory for it is allocated up front.
+//|
+//|         Playing a wave file with an echo::
+//|
+//|           import board
+//|           import audioio
+//|           import audiocore
+//|           import audiomixer
+//|
+//|           a = audioio.AudioOut(board.A0)
+//|           music = audiocore.WaveFile(open("cplay-5.1-16bit-16khz.wav", "rb"))
+//|           effects = audiomixer.Effects(music, max_delay=4000)
+//|           effects.delay = 4000
+//|           effects.feedback = 0.4
+//|           effects.limit = 0.8
+//|           a.play(effects)"""
+//|         ...
+//|
+STATIC mp_obj_t audiomixer_effects_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_sample, ARG_buffer_size, ARG_max_delay };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sample, MP_ARG_OBJ | MP_ARG_REQUIRED },
+        { MP_QSTR_buffer_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1024} },
+        { MP_QSTR_max_delay, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t buffer_size = args[ARG_buffer_size].u_int;
+    if (buffer_size < 16) {
+        mp_raise_ValueError_varg(translate("%q out of range"), MP_QSTR_buffer_size);
+    }
+    mp_int_t max_delay = args[ARG_max_delay].u_int;
+    if (max_delay < 0) {
+        mp_raise_ValueError_varg(translate("%q out of range"), MP_QSTR_max_delay);
+    }
+    audiomixer_effects_obj_t *self = m_new_obj(audiomixer_effects_obj_t);
+    self->base.type = &audiomixer_effects_type;
+    common_hal_audiomixer_effects_construct(self, args[ARG_sample].u_obj, buffer_size, max_delay);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def deinit(self, ) -> Any:
+//|         """Deinitialises the Effects and releases any hardware resources for reuse."""
+//|         ...
+//|
+STATIC mp_obj_t audiomixer_effects_deinit(mp_obj_t self_in) {
+    audiomixer_effects_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_audiomixer_effects_deinit(self);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(audiomixer_effects_deinit_obj, audiomixer_effects_deinit);
+
+STATIC void check_for_deinit(audiomixer_effects_obj_t *self) {
+    if (common_hal_audiomixer_effects_deinited(self)) {
+        raise_deinited_error();
+    }
+}
+
+// Returns value as a float between 0 and 1.
+STATIC mp_float_t get_fraction(mp_obj_t value_in, qstr name) {
+    mp_float_t value = mp_obj_get_float(value_in);
+    if (value < 0 || value > 1) {
+        mp_raise_ValueError_varg(translate("%q must be between 0 and 1"), name);
+    }
+    return value;
+}
+
+//|     def __enter__(self, ) -> Any:
+//|         """No-op used by Context Managers."""
+//|         ...
+//|
+//  Provided by context manager helper.
+
+//|     def __exit__(self, ) -> Any:
+//|         """Automatically deinitializes the hardware when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+//|
+STATIC mp_obj_t audiomixer_effects_obj___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    common_hal_audiomixer_effects_deinit(args[0]);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(audiomixer_effects___exit___obj, 4, 4, audiomixer_effects_obj___exit__);
+
+#if CIRCUITPY_AUDIOMIXER_BENCHMARK
+//|     def benchmark(self, ) -> Any:
+//|         """Runs the whole sample through the effects that are on, without playing it, and
+//|         returns a tuple of the CPU cycles per sample spent reading the sample and in the
+//|         gain, filter, delay and limit stages. Stages that are off take no cycles. Don't call
+//|         it while the Effects is playing.
+//|
+//|         Only available in builds with ``CIRCUITPY_AUDIOMIXER_BENCHMARK = 1``."""
+//|         ...
+//|
+STATIC mp_obj_t audiomixer_effects_obj_benchmark(mp_obj_t self_in) {
+    audiomixer_effects_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    uint32_t cycles[AUDIOMIXER_EFFECTS_STAGE_COUNT] = {0};
+    uint32_t count = common_hal_audiomixer_effects_benchmark(self, cycles);
+    mp_obj_t items[AUDIOMIXER_EFFECTS_STAGE_COUNT];
+    for (size_t i = 0; i < AUDIOMIXER_EFFECTS_STAGE_COUNT; i++) {
+        items[i] = mp_obj_new_float(count == 0 ? 0 : (mp_float_t) cycles[i] / count);
+    }
+    return mp_obj_new_tuple(AUDIOMIXER_EFFECTS_STAGE_COUNT, items);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiomixer_effects_benchmark_obj, audiomixer_effects_obj_benchmark);
+#endif
+
+//|     sample_rate: Any = ...
+//|     """The sample rate of the wrapped sample in Hertz. (read-only)"""
+//|
+STATIC mp_obj_t audiomixer_effects_obj_get_sample_rate(mp_obj_t self_in) {
+    audiomixer_effects_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_audiomixer_effects_get_sample_rate(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiomixer_effects_get_sample_rate_obj, audiomixer_effects_obj_get_sample_rate);
+
+const mp_obj_property_t audiomixer_effects_sample_rate_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&audiomixer_effects_get_sample_rate_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|     gain: float = ...
+//|     """The gain applied to the sample, as a floating point number between 0 and 1.
+//|     Changes ramp smoothly over the next buffer to avoid clicks."""
+//|
+STATIC mp_obj_t audiomixer_effects_obj_get_gain(mp_obj_t self_in) {
+    audiomixer_effects_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_float(common_hal_audiomixer_effects_get_gain(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiomixer_effects_get_gain_obj, audiomixer_effects_obj_get_gain);
+
+STATIC mp_obj_t audiomixer_effects_obj_set_gain(mp_obj_t self_in, mp_obj_t gain) {
+    audiomixer_effects_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_audiomixer_effects_set_gain(self, get_fraction(gain, MP_QSTR_gain));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiomixer_effects_set_gain_obj, audiomixer_effects_obj_set_gain);
+
+const mp_obj_property_t audiomixer_effects_gain_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&audiomixer_effects_get_gain_obj,
+              (mp_obj_t)&audiomixer_effects_set_gain_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|     filter: Optional[Tuple[float, float, float, float, float]] = ...
+//|     """A biquad filter given as its coefficients ``(b0, b1, b2, a1, a2)``, normalized so
+//|     that a0 is 1, or None for no filter. Each coefficient must be greater than -2 and
+//|     less than 2 and is rounded to 14 fractional bits. Setting it clears the filter's state."""
+//|
+STATIC mp_obj_t audiomixer_effects_obj_get_filter(mp_obj_t self_in) {
+    audiomixer_effects_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    float coefficients[5];
+    if (!common_hal_audiomixer_effects_get_filter(self, coefficients)) {
+        return mp_const_none;
+    }
+    mp_obj_t items[5];
+    for (size_t i = 0; i < 5; i++) {
+        items[i] = mp_obj_new_float(coefficients[i]);
+    }
+    return mp_obj_new_tuple(5, items);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiomixer_effects_get_filter_obj, audiomixer_effects_obj_get_filter);
+
+STATIC mp_obj_t audiomixer_effects_obj_set_filter(mp_obj_t self_in, mp_obj_t filter) {
+    audiomixer_effects_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    if (filter == mp_const_none) {
+        common_hal_audiomixer_effects_set_filter(self, NULL);
+        return mp_const_none;
+    }
+    mp_obj_t *items;
+    mp_obj_get_array_fixed_n(filter, 5, &items);
+    float coefficients[5];
+    for (size_t i = 0; i < 5; i++) {
+        coefficients[i] = mp_obj_get_float(items[i]);
+        if (coefficients[i] <= -2 || coefficients[i] >= 2) {
+            mp_raise_ValueError_varg(translate("%q out of range"), MP_QSTR_filter);
+        }
+    }
+    common_hal_audiomixer_effects_set_filter(self, coefficients);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiomixer_effects_set_filter_obj, audiomixer_effects_obj_set_filter);
+
+const mp_obj_property_t audiomixer_effects_filter_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&audiomixer_effects_get_filter_obj,
+              (mp_obj_t)&audiomixer_effects_set_filter_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|     limit: float = ...
+//|     """The level, between 0 and 1, above which samples are softly compressed so that
+//|     they approach full scale without clipping. 1 turns the limiter off."""
+//|
+STATIC mp_obj_t audiomixer_effects_obj_get_limit(mp_obj_t self_in) {
+    audiomixer_effects_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_float(common_hal_audiomixer_effects_get_limit(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiomixer_effects_get_limit_obj, audiomixer_effects_obj_get_limit);
+
+STATIC mp_obj_t audiomixer_effects_obj_set_limit(mp_obj_t self_in, mp_obj_t limit) {
+    audiomixer_effects_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_audiomixer_effects_set_limit(self, get_fraction(limit, MP_QSTR_limit));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiomixer_effects_set_limit_obj, audiomixer_effects_obj_set_limit);
+
+const mp_obj_property_t audiomixer_effects_limit_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&audiomixer_effects_get_limit_obj,
+              (mp_obj_t)&audiomixer_effects_set_limit_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|     delay: int = ...
+//|     """The length of the delay in frames, up to ``max_delay``. 0 turns the delay off.
+//|     Mono delays are rounded up to an even number of frames. Setting it clears the delay."""
+//|
+STATIC mp_obj_t audiomixer_effects_obj_get_delay(mp_obj_t self_in) {
+    audiomixer_effects_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_audiomixer_effects_get_delay(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiomixer_effects_get_delay_obj, audiomixer_effects_obj_get_delay);
+
+STATIC mp_obj_t audiomixer_effects_obj_set_delay(mp_obj_t self_in, mp_obj_t delay_in) {
+    audiomixer_effects_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    mp_int_t delay = mp_obj_get_int(delay_in);
+    if (delay < 0 || (mp_uint_t) delay > common_hal_audiomixer_effects_get_max_delay(self)) {
+        mp_raise_ValueError_varg(translate("%q out of range"), MP_QSTR_delay);
+    }
+    common_hal_audiomixer_effects_set_delay(self, delay);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiomixer_effects_set_delay_obj, audiomixer_effects_obj_set_delay);
+
+const mp_obj_property_t audiomixer_effects_delay_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&audiomixer_effects_get_delay_obj,
+              (mp_obj_t)&audiomixer_effects_set_delay_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|     feedback: float = ...
+//|     """How much of the delayed sound is fed back into the delay, between 0 and 1."""
+//|
+STATIC mp_obj_t audiomixer_effects_obj_get_feedback(mp_obj_t self_in) {
+    audiomixer_effects_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_float(common_hal_audiomixer_effects_get_feedback(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiomixer_effects_get_feedback_obj, audiomixer_effects_obj_get_feedback);
+
+STATIC mp_obj_t audiomixer_effects_obj_set_feedback(mp_obj_t self_in, mp_obj_t feedback) {
+    audiomixer_effects_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_audiomixer_effects_set_feedback(self, get_fraction(feedback, MP_QSTR_feedback));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiomixer_effects_set_feedback_obj, audiomixer_effects_obj_set_feedback);
+
+const mp_obj_property_t audiomixer_effects_feedback_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&audiomixer_effects_get_feedback_obj,
+              (mp_obj_t)&audiomixer_effects_set_feedback_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|     mix: float = ...
+//|     """How much of the delayed sound is added to the output, between 0 and 1."""
+//|
+STATIC mp_obj_t audiomixer_effects_obj_get_mix(mp_obj_t self_in) {
+    audiomixer_effects_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_float(common_hal_audiomixer_effects_get_mix(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiomixer_effects_get_mix_obj, audiomixer_effects_obj_get_mix);
+
+STATIC mp_obj_t audiomixer_effects_obj_set_mix(mp_obj_t self_in, mp_obj_t mix) {
+    audiomixer_effects_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_audiomixer_effects_set_mix(self, get_fraction(mix, MP_QSTR_mix));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiomixer_effects_set_mix_obj, audiomixer_effects_obj_set_mix);
+
+const mp_obj_property_t audiomixer_effects_mix_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&audiomixer_effects_get_mix_obj,
+              (mp_obj_t)&audiomixer_effects_set_mix_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+STATIC const mp_rom_map_elem_t audiomixer_effects_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audiomixer_effects_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&audiomixer_effects___exit___obj) },
+    #if CIRCUITPY_AUDIOMIXER_BENCHMARK
+    { MP_ROM_QSTR(MP_QSTR_benchmark), MP_ROM_PTR(&audiomixer_effects_benchmark_obj) },
+    #endif
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_sample_rate), MP_ROM_PTR(&audiomixer_effects_sample_rate_obj) },
+    { MP_ROM_QSTR(MP_QSTR_gain), MP_ROM_PTR(&audiomixer_effects_gain_obj) },
+    { MP_ROM_QSTR(MP_QSTR_filter), MP_ROM_PTR(&audiomixer_effects_filter_obj) },
+    { MP_ROM_QSTR(MP_QSTR_limit), MP_ROM_PTR(&audiomixer_effects_limit_obj) },
+    { MP_ROM_QSTR(MP_QSTR_delay), MP_ROM_PTR(&audiomixer_effects_delay_obj) },
+    { MP_ROM_QSTR(MP_QSTR_feedback), MP_ROM_PTR(&audiomixer_effects_feedback_obj) },
+    { MP_ROM_QSTR(MP_QSTR_mix), MP_ROM_PTR(&audiomixer_effects_mix_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(audiomixer_effects_locals_dict, audiomixer_effects_locals_dict_table);
+
+STATIC const audiosample_p_t audiomixer_effects_proto = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_audiosample)
+    .sample_rate = (audiosample_sample_rate_fun)common_hal_audiomixer_effects_get_sample_rate,
+    .bits_per_sample = (audiosample_bits_per_sample_fun)common_hal_audiomixer_effects_get_bits_per_sample,
+    .channel_count = (audiosample_channel_count_fun)common_hal_audiomixer_effects_get_channel_count,
+    .reset_buffer = (audiosample_reset_buffer_fun)audiomixer_effects_reset_buffer,
+    .get_buffer = (audiosample_get_buffer_fun)audiomixer_effects_get_buffer,
+    .get_buffer_structure = (audiosample_get_buffer_structure_fun)audiomixer_effects_get_buffer_structure,
+    .prefetch = (audiosample_prefetch_fun)audiomixer_effects_prefetch,
+};
+
+const mp_obj_type_t audiomixer_effects_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_Effects,
+    .make_new = audiomixer_effects_make_new,
+    .locals_dict = (mp_obj_dict_t*)&audiomixer_effects_locals_dict,
+    .protocol = &audiomixer_effects_proto,
+};
@@ -0,0 +1,68 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef MICROPY_INCLUDED_SHARED_BINDINGS_AUDIOMIXER_EFFECTS_H
+#define MICROPY_INCLUDED_SHARED_BINDINGS_AUDIOMIXER_EFFECTS_H
+
+#include "shared-module/audiomixer/Effects.h"
+
+extern const mp_obj_type_t audiomixer_effects_type;
+
+void common_hal_audiomixer_effects_construct(audiomixer_effects_obj_t* self,
+                                             mp_obj_t sample,
+                                             uint32_t buffer_size,
+                                             uint32_t max_delay);
+
+void common_hal_audiomixer_effects_deinit(audiomixer_effects_obj_t* self);
+bool common_hal_audiomixer_effects_deinited(audiomixer_effects_obj_t* self);
+
+uint32_t common_hal_audiomixer_effects_get_sample_rate(audiomixer_effects_obj_t* self);
+uint8_t common_hal_audiomixer_effects_get_channel_count(audiomixer_effects_obj_t* self);
+uint8_t common_hal_audiomixer_effects_get_bits_per_sample(audiomixer_effects_obj_t* self);
+
+float common_hal_audiomixer_effects_get_gain(audiomixer_effects_obj_t* self);
+void common_hal_audiomixer_effects_set_gain(audiomixer_effects_obj_t* self, float gain);
+// Coefficients are b0, b1, b2, a1 and a2. Returns false when there is no filter.
+bool common_hal_audiomixer_effects_get_filter(audiomixer_effects_obj_t* self, float coefficients[5]);
+// NULL removes the filter.
+void common_hal_audiomixer_effects_set_filter(audiomixer_effects_obj_t* self, const float* coefficients);
+float common_hal_audiomixer_effects_get_limit(audiomixer_effects_obj_t* self);
+void common_hal_audiomixer_effects_set_limit(audiomixer_effects_obj_t* self, float limit);
+uint32_t common_hal_audiomixer_effects_get_delay(audiomixer_effects_obj_t* self);
+uint32_t common_hal_audiomixer_effects_get_max_delay(audiomixer_effects_obj_t* self);
+void common_hal_audiomixer_effects_set_delay(audiomixer_effects_obj_t* self, uint32_t delay);
+float common_hal_audiomixer_effects_get_feedback(audiomixer_effects_obj_t* self);
+void common_hal_audiomixer_effects_set_feedback(audiomixer_effects_obj_t* self, float feedback);
+float common_hal_audiomixer_effects_get_mix(audiomixer_effects_obj_t* self);
+void common_hal_audiomixer_effects_set_mix(audiomixer_effects_obj_t* self, float mix);
+
+#if CIRCUITPY_AUDIOMIXER_BENCHMARK
+// Adds the cycles spent in each stage to cycles and returns the number of
+// samples processed.
+uint32_t common_hal_audiomixer_effects_benchmark(audiomixer_effects_obj_t* self,
+                                                 uint32_t cycles[AUDIOMIXER_EFFECTS_STAGE_COUNT]);
+#endif
+
+#endif // MICROPY_INCLUDED_SHARED_BINDINGS_AUDIOMIXER_EFFECTS_H
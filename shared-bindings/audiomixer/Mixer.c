@@ -41,16 +41,22 @@
 //| class Mixer:
 //|     """Mixes one or more audio samples together into one sample."""
 //|
-//|     def __init__(self, voice_count: int = 2, buffer_size: int = 1024, channel_count: int = 2, bits_per_sample: int = 16, samples_signed: bool = True, sample_rate: int = 8000):
-//|         """Create a Mixer object that can mix multiple channels with the same sample rate.
+//|     def __init__(self, voice_count: int = 2, buffer_size: int = 1024, channel_count: int = 2, bits_per_sample: int = 16, samples_signed: bool = True, sample_rate: int = 8000, polyphase: bool = False):
+//|         """Create a Mixer object that can mix multiple channels into one output format.
 //|         Samples are accessed and controlled with the mixer's `audiomixer.MixerVoice` objects.
 //|
+//|         Samples in the mixer's format are mixed directly. Others are converted as they
+//|         play: resampled, mixed down to mono or copied to both stereo channels, and
+//|         changed in size and signedness. This costs more CPU time per voice.
+//|
 //|         :param int voice_count: The maximum number of voices to mix
 //|         :param int buffer_size: The total size in bytes of the buffers to mix into
-//|         :param int channel_count: The number of channels the source samples contain. 1 = mono; 2 = stereo.
-//|         :param int bits_per_sample: The bits per sample of the samples being played
-//|         :param bool samples_signed: Samples are signed (True) or unsigned (False)
-//|         :param int sample_rate: The sample rate to be used for all samples
+//|         :param int channel_count: The number of channels of the mixer's output. 1 = mono; 2 = stereo.
+//|         :param int bits_per_sample: The bits per sample of the mixer's output
+//|         :param bool samples_signed: Output samples are signed (True) or unsigned (False)
+//|         :param int sample_rate: The sample rate of the mixer's output
+//|         :param bool polyphase: Resample with an 8 tap polyphase filter (True) instead of
+//|           linear interpolation (False). The filter reduces aliasing but takes more time.
 //|
 //|         Playing a wave file from flash::
 //|
@@ -79,7 +85,7 @@
 //|         ...
 //|
 STATIC mp_obj_t audiomixer_mixer_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    enum { ARG_voice_count, ARG_buffer_size, ARG_channel_count, ARG_bits_per_sample, ARG_samples_signed, ARG_sample_rate };
+    enum { ARG_voice_count, ARG_buffer_size, ARG_channel_count, ARG_bits_per_sample, ARG_samples_signed, ARG_sample_rate, ARG_polyphase };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_voice_count, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 2} },
         { MP_QSTR_buffer_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1024} },
@@ -87,6 +93,7 @@ STATIC mp_obj_t audiomixer_mixer_make_new(const mp_obj_type_t *type, size_t n_ar
         { MP_QSTR_bits_per_sample, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 16} },
         { MP_QSTR_samples_signed, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = true} },
         { MP_QSTR_sample_rate, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 8000} },
+        { MP_QSTR_polyphase, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -110,7 +117,7 @@ STATIC mp_obj_t audiomixer_mixer_make_new(const mp_obj_type_t *type, size_t n_ar
     }
     audiomixer_mixer_obj_t *self = m_new_obj_var(audiomixer_mixer_obj_t, mp_obj_t, voice_count);
     self->base.type = &audiomixer_mixer_type;
-    common_hal_audiomixer_mixer_construct(self, voice_count, args[ARG_buffer_size].u_int, bits_per_sample, args[ARG_samples_signed].u_bool, channel_count, sample_rate);
+    common_hal_audiomixer_mixer_construct(self, voice_count, args[ARG_buffer_size].u_int, bits_per_sample, args[ARG_samples_signed].u_bool, channel_count, sample_rate, args[ARG_polyphase].u_bool);
 
     for(int v=0; v<voice_count; v++){
     	self->voice[v] = audiomixer_mixervoice_type.make_new(&audiomixer_mixervoice_type, 0, 0, NULL);
@@ -217,7 +224,7 @@ const mp_obj_property_t audiomixer_mixer_voice_obj = {
 //|
 //|         Sample must be an `audiocore.WaveFile`, `audiocore.RawSample`, or `audiomixer.Mixer`.
 //|
-//|         The sample must match the Mixer's encoding settings given in the constructor."""
+//|         Samples that don't match the Mixer's encoding settings are converted as they play."""
 //|         ...
 //|
 STATIC mp_obj_t audiomixer_mixer_obj_play(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
@@ -292,6 +299,7 @@ STATIC const audiosample_p_t audiomixer_mixer_proto = {
     .reset_buffer = (audiosample_reset_buffer_fun)audiomixer_mixer_reset_buffer,
     .get_buffer = (audiosample_get_buffer_fun)audiomixer_mixer_get_buffer,
     .get_buffer_structure = (audiosample_get_buffer_structure_fun)audiomixer_mixer_get_buffer_structure,
+    .prefetch = (audiosample_prefetch_fun)audiomixer_mixer_prefetch,
 };
 
 const mp_obj_type_t audiomixer_mixer_type = {
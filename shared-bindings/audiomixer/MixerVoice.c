@@ -62,7 +62,7 @@ STATIC mp_obj_t audiomixer_mixervoice_make_new(const mp_obj_type_t *type, size_t
 //|
 //|         Sample must be an `audiocore.WaveFile`, `audiomixer.Mixer` or `audiocore.RawSample`.
 //|
-//|         The sample must match the `audiomixer.Mixer`'s encoding settings given in the constructor."""
+//|         Samples that don't match the `audiomixer.Mixer`'s encoding settings are converted as they play."""
 //|         ...
 //|
 STATIC mp_obj_t audiomixer_mixervoice_obj_play(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
@@ -101,7 +101,8 @@ STATIC mp_obj_t audiomixer_mixervoice_obj_stop(size_t n_args, const mp_obj_t *po
 MP_DEFINE_CONST_FUN_OBJ_KW(audiomixer_mixervoice_stop_obj, 1, audiomixer_mixervoice_obj_stop);
 
 //|     level: Any = ...
-//|     """The volume level of a voice, as a floating point number between 0 and 1."""
+//|     """The volume level of a voice, as a floating point number between 0 and 1.
+//|     Changes ramp smoothly over the next mixer buffer to avoid clicks."""
 //|
 STATIC mp_obj_t audiomixer_mixervoice_obj_get_level(mp_obj_t self_in) {
     return mp_obj_new_float(common_hal_audiomixer_mixervoice_get_level(self_in));
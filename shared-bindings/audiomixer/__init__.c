@@ -30,6 +30,7 @@
 #include "py/runtime.h"
 
 #include "shared-bindings/microcontroller/Pin.h"
+#include "shared-bindings/audiomixer/Effects.h"
 #include "shared-bindings/audiomixer/Mixer.h"
 
 //| """Support for audio mixing"""
@@ -37,6 +38,7 @@
 
 STATIC const mp_rom_map_elem_t audiomixer_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_audiomixer) },
+    { MP_ROM_QSTR(MP_QSTR_Effects), MP_ROM_PTR(&audiomixer_effects_type) },
     { MP_ROM_QSTR(MP_QSTR_Mixer), MP_ROM_PTR(&audiomixer_mixer_type) },
 };
 
@@ -37,12 +37,15 @@
 //| class MP3:
 //|     """Load a mp3 file for audio playback"""
 //|
-//|     def __init__(self, file: typing.BinaryIO, buffer: bytearray):
+//|     def __init__(self, file: typing.BinaryIO, buffer: bytearray, *, input_buffer_size: int = 2048):
 //|
 //|         """Load a .mp3 file for playback with `audioio.AudioOut` or `audiobusio.I2SOut`.
 //|
 //|         :param typing.BinaryIO file: Already opened mp3 file
 //|         :param bytearray buffer: Optional pre-allocated buffer, that will be split in half and used for double-buffering of the data. If not provided, two buffers are allocated internally.  The specific buffer size required depends on the mp3 file.
+//|         :param int input_buffer_size: Size of the buffer for data read from the file, at least 2048
+//|           bytes. It is topped up in the background while playing so that slow storage, such as an
+//|           SD card, doesn't cause gaps in the audio. See `underruns`.
 //|
 //|
 //|         Playing a mp3 file from flash::
@@ -67,24 +70,36 @@
 //|           print("stopped")"""
 //|         ...
 //|
-STATIC mp_obj_t audiomp3_mp3file_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *args, mp_map_t *kw_args) {
-    mp_arg_check_num(n_args, kw_args, 1, 2, false);
+STATIC mp_obj_t audiomp3_mp3file_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_file, ARG_buffer, ARG_input_buffer_size };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_file, MP_ARG_OBJ | MP_ARG_REQUIRED },
+        { MP_QSTR_buffer, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_input_buffer_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 2048} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
-    audiomp3_mp3file_obj_t *self = m_new_obj(audiomp3_mp3file_obj_t);
-    self->base.type = &audiomp3_mp3file_type;
-    if (!MP_OBJ_IS_TYPE(args[0], &mp_type_fileio)) {
+    if (!MP_OBJ_IS_TYPE(args[ARG_file].u_obj, &mp_type_fileio)) {
         mp_raise_TypeError(translate("file must be a file opened in byte mode"));
     }
+    mp_int_t input_buffer_size = args[ARG_input_buffer_size].u_int;
+    if (input_buffer_size < 2048) {
+        mp_raise_ValueError_varg(translate("%q out of range"), MP_QSTR_input_buffer_size);
+    }
     uint8_t *buffer = NULL;
     size_t buffer_size = 0;
-    if (n_args >= 2) {
+    if (args[ARG_buffer].u_obj != mp_const_none) {
         mp_buffer_info_t bufinfo;
-        mp_get_buffer_raise(args[1], &bufinfo, MP_BUFFER_WRITE);
+        mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_WRITE);
         buffer = bufinfo.buf;
         buffer_size = bufinfo.len;
     }
-    common_hal_audiomp3_mp3file_construct(self, MP_OBJ_TO_PTR(args[0]),
-                                          buffer, buffer_size);
+
+    audiomp3_mp3file_obj_t *self = m_new_obj(audiomp3_mp3file_obj_t);
+    self->base.type = &audiomp3_mp3file_type;
+    common_hal_audiomp3_mp3file_construct(self, MP_OBJ_TO_PTR(args[ARG_file].u_obj),
+                                          buffer, buffer_size, input_buffer_size);
 
     return MP_OBJ_FROM_PTR(self);
 }
@@ -232,6 +247,24 @@ const mp_obj_property_t audiomp3_mp3file_rms_level_obj = {
               (mp_obj_t)&mp_const_none_obj},
 };
 
+//|     underruns: int = ...
+//|     """Number of times the input buffer had to be read from the file while decoding because the
+//|     background read ahead hadn't kept up. Increase ``input_buffer_size`` if this goes up while
+//|     playing. (read only)"""
+//|
+STATIC mp_obj_t audiomp3_mp3file_obj_get_underruns(mp_obj_t self_in) {
+    audiomp3_mp3file_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_audiomp3_mp3file_get_underruns(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiomp3_mp3file_get_underruns_obj, audiomp3_mp3file_obj_get_underruns);
+
+const mp_obj_property_t audiomp3_mp3file_underruns_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&audiomp3_mp3file_get_underruns_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
 
 STATIC const mp_rom_map_elem_t audiomp3_mp3file_locals_dict_table[] = {
     // Methods
@@ -245,6 +278,7 @@ STATIC const mp_rom_map_elem_t audiomp3_mp3file_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_bits_per_sample), MP_ROM_PTR(&audiomp3_mp3file_bits_per_sample_obj) },
     { MP_ROM_QSTR(MP_QSTR_channel_count), MP_ROM_PTR(&audiomp3_mp3file_channel_count_obj) },
     { MP_ROM_QSTR(MP_QSTR_rms_level), MP_ROM_PTR(&audiomp3_mp3file_rms_level_obj) },
+    { MP_ROM_QSTR(MP_QSTR_underruns), MP_ROM_PTR(&audiomp3_mp3file_underruns_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(audiomp3_mp3file_locals_dict, audiomp3_mp3file_locals_dict_table);
 
@@ -256,6 +290,7 @@ STATIC const audiosample_p_t audiomp3_mp3file_proto = {
     .reset_buffer = (audiosample_reset_buffer_fun)audiomp3_mp3file_reset_buffer,
     .get_buffer = (audiosample_get_buffer_fun)audiomp3_mp3file_get_buffer,
     .get_buffer_structure = (audiosample_get_buffer_structure_fun)audiomp3_mp3file_get_buffer_structure,
+    .prefetch = (audiosample_prefetch_fun)audiomp3_mp3file_prefetch,
 };
 
 const mp_obj_type_t audiomp3_mp3file_type = {
@@ -36,7 +36,7 @@
 extern const mp_obj_type_t audiomp3_mp3file_type;
 
 void common_hal_audiomp3_mp3file_construct(audiomp3_mp3file_obj_t* self,
-    pyb_file_obj_t* file, uint8_t *buffer, size_t buffer_size);
+    pyb_file_obj_t* file, uint8_t *buffer, size_t buffer_size, size_t input_buffer_size);
 
 void common_hal_audiomp3_mp3file_set_file(audiomp3_mp3file_obj_t* self, pyb_file_obj_t* file);
 void common_hal_audiomp3_mp3file_deinit(audiomp3_mp3file_obj_t* self);
@@ -46,5 +46,6 @@ void common_hal_audiomp3_mp3file_set_sample_rate(audiomp3_mp3file_obj_t* self, u
 uint8_t common_hal_audiomp3_mp3file_get_bits_per_sample(audiomp3_mp3file_obj_t* self);
 uint8_t common_hal_audiomp3_mp3file_get_channel_count(audiomp3_mp3file_obj_t* self);
 float common_hal_audiomp3_mp3file_get_rms_level(audiomp3_mp3file_obj_t* self);
+uint32_t common_hal_audiomp3_mp3file_get_underruns(audiomp3_mp3file_obj_t* self);
 
 #endif // MICROPY_INCLUDED_SHARED_BINDINGS_AUDIOIO_MP3FILE_H
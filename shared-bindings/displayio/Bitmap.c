@@ -32,7 +32,6 @@
 #include "py/binary.h"
 #include "py/objproperty.h"
 #include "py/runtime.h"
-#include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/util.h"
 #include "supervisor/shared/translate.h"
 
@@ -189,10 +188,126 @@ STATIC mp_obj_t displayio_bitmap_obj_fill(mp_obj_t self_in, mp_obj_t value_obj)
 }
 MP_DEFINE_CONST_FUN_OBJ_2(displayio_bitmap_fill_obj, displayio_bitmap_obj_fill);
 
+// Orders a pair of coordinates and clamps them to 0 through limit.
+STATIC void bitmap_clamp_range(mp_int_t *start, mp_int_t *end, mp_int_t limit) {
+    if (*start > *end) {
+        mp_int_t temp = *start;
+        *start = *end;
+        *end = temp;
+    }
+    *start = MIN(MAX(*start, 0), limit);
+    *end = MIN(MAX(*end, 0), limit);
+}
+
+//|     def fill_region(self, x1: int, y1: int, x2: int, y2: int, value: int) -> Any:
+//|         """Fills the rectangle from x1,y1 up to, but not including, x2,y2 with the supplied palette
+//|         index value. The rectangle is clipped to the bitmap."""
+//|         ...
+//|
+STATIC mp_obj_t displayio_bitmap_obj_fill_region(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_x1, ARG_y1, ARG_x2, ARG_y2, ARG_value };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_x1, MP_ARG_REQUIRED | MP_ARG_INT },
+        { MP_QSTR_y1, MP_ARG_REQUIRED | MP_ARG_INT },
+        { MP_QSTR_x2, MP_ARG_REQUIRED | MP_ARG_INT },
+        { MP_QSTR_y2, MP_ARG_REQUIRED | MP_ARG_INT },
+        { MP_QSTR_value, MP_ARG_REQUIRED | MP_ARG_INT },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    displayio_bitmap_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+
+    mp_int_t value = args[ARG_value].u_int;
+    if (value >= 1 << common_hal_displayio_bitmap_get_bits_per_value(self)) {
+        mp_raise_ValueError(translate("pixel value requires too many bits"));
+    }
+    mp_int_t x1 = args[ARG_x1].u_int;
+    mp_int_t x2 = args[ARG_x2].u_int;
+    mp_int_t y1 = args[ARG_y1].u_int;
+    mp_int_t y2 = args[ARG_y2].u_int;
+    bitmap_clamp_range(&x1, &x2, common_hal_displayio_bitmap_get_width(self));
+    bitmap_clamp_range(&y1, &y2, common_hal_displayio_bitmap_get_height(self));
+    common_hal_displayio_bitmap_fill_region(self, x1, y1, x2, y2, value);
+
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(displayio_bitmap_fill_region_obj, 1, displayio_bitmap_obj_fill_region);
+
+//|     def blit(self, x: int, y: int, source_bitmap: displayio.Bitmap, *, x1: int = 0, y1: int = 0, x2: int = -1, y2: int = -1, skip_index: int = None) -> Any:
+//|         """Copies a rectangle of values from source_bitmap into this bitmap with its top left corner
+//|         at x,y. Source values equal to skip_index are not copied, which is useful for drawing glyphs
+//|         and sprites over a background. The source bitmap may be this bitmap.
+//|
+//|         :param int x: Horizontal pixel location in this bitmap to copy to
+//|         :param int y: Vertical pixel location in this bitmap to copy to
+//|         :param Bitmap source_bitmap: Bitmap to copy values from. Its values must fit in this bitmap.
+//|         :param int x1: Left edge of the source rectangle
+//|         :param int y1: Top edge of the source rectangle
+//|         :param int x2: Right edge of the source rectangle, exclusive. Defaults to the source width.
+//|         :param int y2: Bottom edge of the source rectangle, exclusive. Defaults to the source height.
+//|         :param int skip_index: Source value to leave transparent, or None to copy every value"""
+//|         ...
+//|
+STATIC mp_obj_t displayio_bitmap_obj_blit(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_x, ARG_y, ARG_source_bitmap, ARG_x1, ARG_y1, ARG_x2, ARG_y2, ARG_skip_index };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_x, MP_ARG_REQUIRED | MP_ARG_INT },
+        { MP_QSTR_y, MP_ARG_REQUIRED | MP_ARG_INT },
+        { MP_QSTR_source_bitmap, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_x1, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_y1, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_x2, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = -1} },
+        { MP_QSTR_y2, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = -1} },
+        { MP_QSTR_skip_index, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    displayio_bitmap_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+
+    mp_obj_t source_obj = args[ARG_source_bitmap].u_obj;
+    if (!MP_OBJ_IS_TYPE(source_obj, &displayio_bitmap_type)) {
+        mp_raise_TypeError_varg(translate("Expected a %q"), displayio_bitmap_type.name);
+    }
+    displayio_bitmap_t *source = MP_OBJ_TO_PTR(source_obj);
+    if (common_hal_displayio_bitmap_get_bits_per_value(source) > common_hal_displayio_bitmap_get_bits_per_value(self)) {
+        mp_raise_ValueError(translate("pixel value requires too many bits"));
+    }
+
+    mp_int_t x = args[ARG_x].u_int;
+    mp_int_t y = args[ARG_y].u_int;
+    if (x < 0 || y < 0 || x >= common_hal_displayio_bitmap_get_width(self) || y >= common_hal_displayio_bitmap_get_height(self)) {
+        mp_raise_IndexError(translate("pixel coordinates out of bounds"));
+    }
+
+    uint16_t source_width = common_hal_displayio_bitmap_get_width(source);
+    uint16_t source_height = common_hal_displayio_bitmap_get_height(source);
+    mp_int_t x1 = args[ARG_x1].u_int;
+    mp_int_t y1 = args[ARG_y1].u_int;
+    mp_int_t x2 = args[ARG_x2].u_int == -1 ? source_width : args[ARG_x2].u_int;
+    mp_int_t y2 = args[ARG_y2].u_int == -1 ? source_height : args[ARG_y2].u_int;
+    bitmap_clamp_range(&x1, &x2, source_width);
+    bitmap_clamp_range(&y1, &y2, source_height);
+
+    uint32_t skip_index = 0;
+    bool skip_index_none = args[ARG_skip_index].u_obj == mp_const_none;
+    if (!skip_index_none) {
+        skip_index = mp_obj_get_int(args[ARG_skip_index].u_obj);
+    }
+
+    common_hal_displayio_bitmap_blit(self, x, y, source, x1, y1, x2, y2, skip_index, skip_index_none);
+
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(displayio_bitmap_blit_obj, 1, displayio_bitmap_obj_blit);
+
 STATIC const mp_rom_map_elem_t displayio_bitmap_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_height), MP_ROM_PTR(&displayio_bitmap_height_obj) },
     { MP_ROM_QSTR(MP_QSTR_width), MP_ROM_PTR(&displayio_bitmap_width_obj) },
     { MP_ROM_QSTR(MP_QSTR_fill), MP_ROM_PTR(&displayio_bitmap_fill_obj) },
+    { MP_ROM_QSTR(MP_QSTR_fill_region), MP_ROM_PTR(&displayio_bitmap_fill_region_obj) },
+    { MP_ROM_QSTR(MP_QSTR_blit), MP_ROM_PTR(&displayio_bitmap_blit_obj) },
 
 };
 STATIC MP_DEFINE_CONST_DICT(displayio_bitmap_locals_dict, displayio_bitmap_locals_dict_table);
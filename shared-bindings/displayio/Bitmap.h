@@ -42,5 +42,10 @@ uint32_t common_hal_displayio_bitmap_get_bits_per_value(displayio_bitmap_t *self
 void common_hal_displayio_bitmap_set_pixel(displayio_bitmap_t *bitmap, int16_t x, int16_t y, uint32_t value);
 uint32_t common_hal_displayio_bitmap_get_pixel(displayio_bitmap_t *bitmap, int16_t x, int16_t y);
 void common_hal_displayio_bitmap_fill(displayio_bitmap_t *bitmap, uint32_t value);
+void common_hal_displayio_bitmap_fill_region(displayio_bitmap_t *bitmap, int16_t x1, int16_t y1,
+                                             int16_t x2, int16_t y2, uint32_t value);
+void common_hal_displayio_bitmap_blit(displayio_bitmap_t *bitmap, int16_t x, int16_t y,
+                                      displayio_bitmap_t *source, int16_t x1, int16_t y1,
+                                      int16_t x2, int16_t y2, uint32_t skip_index, bool skip_index_none);
 
 #endif // MICROPY_INCLUDED_SHARED_BINDINGS_DISPLAYIO_BITMAP_H
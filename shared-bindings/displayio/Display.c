@@ -412,6 +412,58 @@ const mp_obj_property_t displayio_display_bus_obj = {
               (mp_obj_t)&mp_const_none_obj},
 };
 
+//|     refresh_timing: Any = ...
+//|     """A tuple of the microseconds spent compositing pixels and sending them to the display bus
+//|        during the last refresh. (read-only)"""
+//|
+STATIC mp_obj_t displayio_display_obj_get_refresh_timing(mp_obj_t self_in) {
+    displayio_display_obj_t *self = native_display(self_in);
+    uint32_t render_us;
+    uint32_t transfer_us;
+    common_hal_displayio_display_get_refresh_timing(self, &render_us, &transfer_us);
+    mp_obj_t timing[2] = {
+        mp_obj_new_int_from_uint(render_us),
+        mp_obj_new_int_from_uint(transfer_us)
+    };
+    return mp_obj_new_tuple(2, timing);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_display_get_refresh_timing_obj, displayio_display_obj_get_refresh_timing);
+
+const mp_obj_property_t displayio_display_refresh_timing_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&displayio_display_get_refresh_timing_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|     refresh_area_overhead: Any = ...
+//|     """The cost of refreshing one more separate area, in pixels. Dirty areas are merged when
+//|        refreshing their union draws fewer extra pixels than this. Raise it when many small
+//|        areas change at once and per-area bus commands dominate the refresh."""
+//|
+STATIC mp_obj_t displayio_display_obj_get_refresh_area_overhead(mp_obj_t self_in) {
+    displayio_display_obj_t *self = native_display(self_in);
+    return mp_obj_new_int_from_uint(common_hal_displayio_display_get_refresh_area_overhead(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_display_get_refresh_area_overhead_obj, displayio_display_obj_get_refresh_area_overhead);
+
+STATIC mp_obj_t displayio_display_obj_set_refresh_area_overhead(mp_obj_t self_in, mp_obj_t overhead_obj) {
+    displayio_display_obj_t *self = native_display(self_in);
+    mp_int_t overhead = mp_obj_get_int(overhead_obj);
+    if (overhead < 1) {
+        mp_raise_ValueError_varg(translate("%q must be >= 1"), MP_QSTR_refresh_area_overhead);
+    }
+    common_hal_displayio_display_set_refresh_area_overhead(self, overhead);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(displayio_display_set_refresh_area_overhead_obj, displayio_display_obj_set_refresh_area_overhead);
+
+const mp_obj_property_t displayio_display_refresh_area_overhead_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&displayio_display_get_refresh_area_overhead_obj,
+              (mp_obj_t)&displayio_display_set_refresh_area_overhead_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
 
 //|     def fill_row(self, y: int, buffer: bytearray) -> Any:
 //|         """Extract the pixels from a single row
@@ -488,6 +540,8 @@ STATIC const mp_rom_map_elem_t displayio_display_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_height), MP_ROM_PTR(&displayio_display_height_obj) },
     { MP_ROM_QSTR(MP_QSTR_rotation), MP_ROM_PTR(&displayio_display_rotation_obj) },
     { MP_ROM_QSTR(MP_QSTR_bus), MP_ROM_PTR(&displayio_display_bus_obj) },
+    { MP_ROM_QSTR(MP_QSTR_refresh_area_overhead), MP_ROM_PTR(&displayio_display_refresh_area_overhead_obj) },
+    { MP_ROM_QSTR(MP_QSTR_refresh_timing), MP_ROM_PTR(&displayio_display_refresh_timing_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(displayio_display_locals_dict, displayio_display_locals_dict_table);
 
@@ -70,6 +70,9 @@ mp_float_t common_hal_displayio_display_get_brightness(displayio_display_obj_t*
 bool common_hal_displayio_display_set_brightness(displayio_display_obj_t* self, mp_float_t brightness);
 
 mp_obj_t common_hal_displayio_display_get_bus(displayio_display_obj_t* self);
+uint32_t common_hal_displayio_display_get_refresh_area_overhead(displayio_display_obj_t* self);
+void common_hal_displayio_display_set_refresh_area_overhead(displayio_display_obj_t* self, uint32_t overhead);
+void common_hal_displayio_display_get_refresh_timing(displayio_display_obj_t* self, uint32_t* render_us, uint32_t* transfer_us);
 
 
 #endif // MICROPY_INCLUDED_SHARED_BINDINGS_DISPLAYIO_DISPLAY_H
@@ -0,0 +1,213 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/audiocore/SampleQueue.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "py/runtime.h"
+
+#include "shared-module/audiocore/SampleQueue.h"
+#include "supervisor/shared/translate.h"
+
+void common_hal_audioio_samplequeue_construct(audioio_samplequeue_obj_t* self,
+                                              uint32_t buffer_size,
+                                              uint8_t bits_per_sample,
+                                              uint8_t channel_count,
+                                              uint32_t sample_rate) {
+    self->bits_per_sample = bits_per_sample;
+    self->channel_count = channel_count;
+    self->sample_rate = sample_rate;
+    // Keep every buffer handed out word aligned and a whole number of frames.
+    self->buffer_size = (buffer_size + 3) & ~(sizeof(uint32_t) - 1);
+    // Hand out small pieces of the ring so that most of it can be written to
+    // while the rest plays.
+    self->len = (self->buffer_size / 8) & ~(sizeof(uint32_t) - 1);
+    self->buffer = m_malloc(self->buffer_size + self->len, false);
+    if (self->buffer == NULL) {
+        common_hal_audioio_samplequeue_deinit(self);
+        mp_raise_msg(&mp_type_MemoryError,
+                     translate("Couldn't allocate input buffer"));
+    }
+    // Eight bit samples are unsigned like they are in a WaveFile.
+    memset(self->buffer + self->buffer_size, bits_per_sample == 8 ? 0x80 : 0, self->len);
+
+    self->write_index = 0;
+    self->play_index = 0;
+    self->read_index = 0;
+    self->held_index[0] = 0;
+    self->held_index[1] = 0;
+    self->queue_ran = false;
+    self->underruns = 0;
+    self->read_count = 0;
+    self->left_read_count = 0;
+    self->right_read_count = 0;
+}
+
+void common_hal_audioio_samplequeue_deinit(audioio_samplequeue_obj_t* self) {
+    self->buffer = NULL;
+}
+
+bool common_hal_audioio_samplequeue_deinited(audioio_samplequeue_obj_t* self) {
+    return self->buffer == NULL;
+}
+
+uint32_t common_hal_audioio_samplequeue_write(audioio_samplequeue_obj_t* self,
+                                              const uint8_t* data, uint32_t len) {
+    uint32_t write_index = self->write_index;
+    uint32_t used = (write_index + self->buffer_size - self->read_index) % self->buffer_size;
+    uint32_t space = self->buffer_size - sizeof(uint32_t) - used;
+    uint32_t frame_size = self->channel_count * self->bits_per_sample / 8;
+    len = MIN(len, space);
+    len -= len % frame_size;
+
+    uint32_t first = MIN(len, self->buffer_size - write_index);
+    memcpy(self->buffer + write_index, data, first);
+    memcpy(self->buffer, data + first, len - first);
+    // The data must be in the ring before get_buffer can see it.
+    __sync_synchronize();
+    self->write_index = (write_index + len) % self->buffer_size;
+    return len;
+}
+
+uint32_t common_hal_audioio_samplequeue_get_level(audioio_samplequeue_obj_t* self) {
+    return (self->write_index + self->buffer_size - self->play_index) % self->buffer_size;
+}
+
+uint32_t common_hal_audioio_samplequeue_get_underruns(audioio_samplequeue_obj_t* self) {
+    return self->underruns;
+}
+
+uint32_t common_hal_audioio_samplequeue_get_sample_rate(audioio_samplequeue_obj_t* self) {
+    return self->sample_rate;
+}
+
+void common_hal_audioio_samplequeue_set_sample_rate(audioio_samplequeue_obj_t* self,
+                                                    uint32_t sample_rate) {
+    self->sample_rate = sample_rate;
+}
+
+uint8_t common_hal_audioio_samplequeue_get_bits_per_sample(audioio_samplequeue_obj_t* self) {
+    return self->bits_per_sample;
+}
+
+uint8_t common_hal_audioio_samplequeue_get_channel_count(audioio_samplequeue_obj_t* self) {
+    return self->channel_count;
+}
+
+void audioio_samplequeue_reset_buffer(audioio_samplequeue_obj_t* self,
+                                      bool single_channel,
+                                      uint8_t channel) {
+    if (single_channel && channel == 1) {
+        return;
+    }
+    // Nothing handed out before is playing any more. Data still queued is
+    // played from the start.
+    self->held_index[0] = self->play_index;
+    self->held_index[1] = self->play_index;
+    self->read_index = self->play_index;
+    self->queue_ran = false;
+    self->read_count = 0;
+    self->left_read_count = 0;
+    self->right_read_count = 0;
+}
+
+// Hand out the next piece of the ring, or silence when nothing has been
+// written. The queue never runs out so playback continues until it is stopped.
+audioio_get_buffer_result_t audioio_samplequeue_get_buffer(audioio_samplequeue_obj_t* self,
+                                                           bool single_channel,
+                                                           uint8_t channel,
+                                                           uint8_t** buffer,
+                                                           uint32_t* buffer_length) {
+    if (!single_channel) {
+        channel = 0;
+    }
+
+    uint32_t channel_read_count = self->left_read_count;
+    if (channel == 1) {
+        channel_read_count = self->right_read_count;
+    }
+
+    if (self->read_count == channel_read_count) {
+        // The buffer handed out three buffers ago has finished on every
+        // channel so it may be written over.
+        self->read_index = self->held_index[0];
+        self->held_index[0] = self->held_index[1];
+
+        uint32_t play_index = self->play_index;
+        uint32_t write_index = self->write_index;
+        // Don't look at the data until write_index has been read.
+        __sync_synchronize();
+        uint32_t length = self->buffer_size - play_index;
+        if (write_index >= play_index) {
+            length = write_index - play_index;
+        }
+        length = MIN(length, self->len) & ~(sizeof(uint32_t) - 1);
+
+        uint32_t slot = self->read_count % 2;
+        self->held_index[1] = play_index;
+        if (length == 0) {
+            if (self->queue_ran) {
+                self->underruns += 1;
+                self->queue_ran = false;
+            }
+            self->buffers[slot] = self->buffer + self->buffer_size;
+            self->buffer_lengths[slot] = self->len;
+        } else {
+            self->queue_ran = true;
+            self->buffers[slot] = self->buffer + play_index;
+            self->buffer_lengths[slot] = length;
+            self->play_index = (play_index + length) % self->buffer_size;
+        }
+        self->read_count += 1;
+    }
+
+    uint32_t buffers_back = self->read_count - 1 - channel_read_count;
+    uint32_t slot = (self->read_count - 1 - buffers_back) % 2;
+    *buffer = self->buffers[slot];
+    *buffer_length = self->buffer_lengths[slot];
+
+    if (channel == 0) {
+        self->left_read_count += 1;
+    } else if (channel == 1) {
+        self->right_read_count += 1;
+        *buffer = *buffer + self->bits_per_sample / 8;
+    }
+
+    return GET_BUFFER_MORE_DATA;
+}
+
+void audioio_samplequeue_get_buffer_structure(audioio_samplequeue_obj_t* self, bool single_channel,
+                                              bool* single_buffer, bool* samples_signed,
+                                              uint32_t* max_buffer_length, uint8_t* spacing) {
+    *single_buffer = false;
+    *samples_signed = self->bits_per_sample > 8;
+    *max_buffer_length = self->len;
+    if (single_channel) {
+        *spacing = self->channel_count;
+    } else {
+        *spacing = 1;
+    }
+}
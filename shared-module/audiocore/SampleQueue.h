@@ -0,0 +1,74 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SHARED_MODULE_AUDIOIO_SAMPLEQUEUE_H
+#define MICROPY_INCLUDED_SHARED_MODULE_AUDIOIO_SAMPLEQUEUE_H
+
+#include "py/obj.h"
+
+#include "shared-module/audiocore/__init__.h"
+
+// The queue is a single producer, single consumer ring. write() is the only
+// producer and only moves write_index. get_buffer is the only consumer and only
+// moves play_index and read_index. One word of the ring is always left unused
+// so that a full ring can be told apart from an empty one.
+typedef struct {
+    mp_obj_base_t base;
+    uint8_t* buffer; // buffer_size bytes of ring followed by len bytes of silence
+    uint32_t buffer_size; // A multiple of 4
+    uint32_t len; // Most bytes handed out at once
+    volatile uint32_t write_index; // Where the next write goes
+    volatile uint32_t play_index; // Where the next buffer handed out starts
+    volatile uint32_t read_index; // Data before this is free to be overwritten
+    // Where the last two buffers handed out start in the ring. They, and the
+    // one before them, may still be playing.
+    uint32_t held_index[2];
+    uint8_t* buffers[2];
+    uint32_t buffer_lengths[2];
+    uint8_t bits_per_sample;
+    uint8_t channel_count;
+    uint32_t sample_rate;
+    bool queue_ran; // True while queued data is being played
+    uint32_t underruns;
+
+    // Track channels when single_channel is set as in WaveFile.
+    uint32_t read_count;
+    uint32_t left_read_count;
+    uint32_t right_read_count;
+} audioio_samplequeue_obj_t;
+
+// These are not available from Python because it may be called in an interrupt.
+void audioio_samplequeue_reset_buffer(audioio_samplequeue_obj_t* self,
+                                      bool single_channel,
+                                      uint8_t channel);
+audioio_get_buffer_result_t audioio_samplequeue_get_buffer(audioio_samplequeue_obj_t* self,
+                                                           bool single_channel,
+                                                           uint8_t channel,
+                                                           uint8_t** buffer,
+                                                           uint32_t* buffer_length); // length in bytes
+void audioio_samplequeue_get_buffer_structure(audioio_samplequeue_obj_t* self, bool single_channel,
+                                              bool* single_buffer, bool* samples_signed,
+                                              uint32_t* max_buffer_length, uint8_t* spacing);
+
+#endif // MICROPY_INCLUDED_SHARED_MODULE_AUDIOIO_SAMPLEQUEUE_H
@@ -33,6 +33,7 @@
 #include "py/runtime.h"
 
 #include "shared-module/audiocore/WaveFile.h"
+#include "supervisor/flash.h"
 #include "supervisor/shared/translate.h"
 
 struct wave_format_chunk {
@@ -45,10 +46,68 @@ struct wave_format_chunk {
     uint16_t extra_params; // Assumed to be zero below.
 };
 
+// Find where the sample data is in memory mapped flash so that it can be played without copying
+// it. Returns false if it can't be, such as when the file is on an SD card or SPI flash or is too
+// fragmented.
+STATIC bool audioio_wavefile_map(audioio_wavefile_obj_t* self) {
+    FIL* fp = &self->file->fp;
+    FATFS* fs = fp->obj.fs;
+    // Samples must stay word aligned.
+    if (self->data_start % sizeof(uint32_t) != 0) {
+        return false;
+    }
+    DWORD link_map[1 + 2 * AUDIOIO_WAVEFILE_MAX_FRAGMENTS + 1];
+    link_map[0] = MP_ARRAY_SIZE(link_map);
+    fp->cltbl = link_map;
+    FRESULT result = f_lseek(fp, CREATE_LINKMAP);
+    fp->cltbl = NULL;
+    if (result != FR_OK) {
+        return false;
+    }
+
+    audioio_wavefile_fragment_t fragments[AUDIOIO_WAVEFILE_MAX_FRAGMENTS];
+    uint8_t fragment_count = 0;
+    uint32_t skip = self->data_start;
+    // A partial word at the end can't be padded in flash so it is left out.
+    uint32_t length = self->file_length & ~(sizeof(uint32_t) - 1);
+    uint32_t remaining = length;
+    // Each entry is a run of contiguous clusters: its length then its first cluster.
+    for (DWORD* link = link_map + 1; *link != 0 && remaining > 0; link += 2) {
+        uint32_t blocks = link[0] * fs->csize;
+        uint32_t run_length = blocks * FILESYSTEM_BLOCK_SIZE;
+        if (skip >= run_length) {
+            skip -= run_length;
+            continue;
+        }
+        DWORD first_block = fs->database + (link[1] - 2) * fs->csize;
+        const uint8_t* start = supervisor_flash_get_vfs_block_address(fs->drv, first_block);
+        const uint8_t* last = supervisor_flash_get_vfs_block_address(fs->drv, first_block + blocks - 1);
+        if (start == NULL || last != start + run_length - FILESYSTEM_BLOCK_SIZE) {
+            return false;
+        }
+        fragments[fragment_count].data = start + skip;
+        fragments[fragment_count].length = MIN(run_length - skip, remaining);
+        remaining -= fragments[fragment_count].length;
+        fragment_count++;
+        skip = 0;
+    }
+    if (fragment_count == 0 || remaining > 0) {
+        return false;
+    }
+
+    self->fragments = m_malloc(fragment_count * sizeof(audioio_wavefile_fragment_t), false);
+    memcpy(self->fragments, fragments, fragment_count * sizeof(audioio_wavefile_fragment_t));
+    self->fragment_count = fragment_count;
+    self->file_length = length;
+    return true;
+}
+
 void common_hal_audioio_wavefile_construct(audioio_wavefile_obj_t* self,
                                            pyb_file_obj_t* file,
                                            uint8_t *buffer,
-                                           size_t buffer_size) {
+                                           size_t buffer_size,
+                                           uint8_t buffer_count,
+                                           bool play_from_flash) {
     // Load the wave
     self->file = file;
     uint8_t chunk_header[16];
@@ -110,37 +169,49 @@ void common_hal_audioio_wavefile_construct(audioio_wavefile_obj_t* self,
     self->file_length = data_length;
     self->data_start = self->file->fp.fptr;
 
-    // Try to allocate two buffers, one will be loaded from file and the other
-    // DMAed to DAC.
+    self->buffer_index = 0;
+    self->loaded = 0;
+    self->reset_index = 0;
+    self->underruns = 0;
+    self->buffer = NULL;
+    self->fragments = NULL;
+
+    // Only when asked, because the file must then be left alone until the
+    // WaveFile is done with it.
+    if (play_from_flash && audioio_wavefile_map(self)) {
+        // The buffers given out point into flash so none are needed. They are
+        // kept to a block so that players copying them don't need much memory.
+        self->buffer_count = 2;
+        self->len = FILESYSTEM_BLOCK_SIZE;
+        return;
+    }
+
+    // Split the buffer into buffer_count buffers. One is DMAed to the DAC while
+    // the next is loaded from the file, one more is kept for a lagging channel
+    // and the rest are read ahead.
+    self->buffer_count = buffer_count;
     if (buffer_size) {
-        self->len = buffer_size / 2;
+        // Keep every buffer word aligned.
+        self->len = (buffer_size / buffer_count) & ~(sizeof(uint32_t) - 1);
         self->buffer = buffer;
-        self->second_buffer = buffer + self->len;
     } else {
         self->len = 256;
-        self->buffer = m_malloc(self->len, false);
+        self->buffer = m_malloc(self->len * buffer_count, false);
         if (self->buffer == NULL) {
             common_hal_audioio_wavefile_deinit(self);
             mp_raise_msg(&mp_type_MemoryError,
                          translate("Couldn't allocate first buffer"));
         }
-
-        self->second_buffer = m_malloc(self->len, false);
-        if (self->second_buffer == NULL) {
-            common_hal_audioio_wavefile_deinit(self);
-            mp_raise_msg(&mp_type_MemoryError,
-                         translate("Couldn't allocate second buffer"));
-        }
     }
 }
 
 void common_hal_audioio_wavefile_deinit(audioio_wavefile_obj_t* self) {
     self->buffer = NULL;
-    self->second_buffer = NULL;
+    self->fragments = NULL;
 }
 
 bool common_hal_audioio_wavefile_deinited(audioio_wavefile_obj_t* self) {
-    return self->buffer == NULL;
+    return self->buffer == NULL && self->fragments == NULL;
 }
 
 uint32_t common_hal_audioio_wavefile_get_sample_rate(audioio_wavefile_obj_t* self) {
@@ -164,8 +235,12 @@ bool audioio_wavefile_samples_signed(audioio_wavefile_obj_t* self) {
     return self->bits_per_sample > 8;
 }
 
+uint32_t common_hal_audioio_wavefile_get_underruns(audioio_wavefile_obj_t* self) {
+    return self->underruns;
+}
+
 uint32_t audioio_wavefile_max_buffer_length(audioio_wavefile_obj_t* self) {
-    return 512;
+    return self->len;
 }
 
 void audioio_wavefile_reset_buffer(audioio_wavefile_obj_t* self,
@@ -177,10 +252,85 @@ void audioio_wavefile_reset_buffer(audioio_wavefile_obj_t* self,
     // We don't reset the buffer index in case we're looping and we have an odd number of buffer
     // loads
     self->bytes_remaining = self->file_length;
-    f_lseek(&self->file->fp, self->data_start);
+    if (self->fragments != NULL) {
+        self->fragment = 0;
+        self->fragment_offset = 0;
+    } else {
+        f_lseek(&self->file->fp, self->data_start);
+    }
     self->read_count = 0;
     self->left_read_count = 0;
     self->right_read_count = 0;
+    // Anything read ahead came from the old file position.
+    self->loaded = self->buffer_index;
+    self->reset_index = self->buffer_index;
+}
+
+// Point the next buffer's slot at the next piece of the data in flash.
+STATIC void audioio_wavefile_map_buffer(audioio_wavefile_obj_t* self) {
+    uint32_t slot = self->loaded % self->buffer_count;
+    const audioio_wavefile_fragment_t* fragment = &self->fragments[self->fragment];
+    uint32_t length = MIN(fragment->length - self->fragment_offset, self->len);
+    self->buffer_data[slot] = fragment->data + self->fragment_offset;
+    self->buffer_lengths[slot] = length;
+    self->fragment_offset += length;
+    if (self->fragment_offset == fragment->length) {
+        self->fragment += 1;
+        self->fragment_offset = 0;
+    }
+    self->bytes_remaining -= length;
+    self->loaded += 1;
+}
+
+// Read the next buffer of the file into its slot.
+STATIC bool audioio_wavefile_load_buffer(audioio_wavefile_obj_t* self) {
+    if (self->fragments != NULL) {
+        audioio_wavefile_map_buffer(self);
+        return true;
+    }
+    uint32_t slot = self->loaded % self->buffer_count;
+    uint8_t* buffer = self->buffer + slot * self->len;
+    uint32_t num_bytes_to_load = self->len;
+    if (num_bytes_to_load > self->bytes_remaining) {
+        num_bytes_to_load = self->bytes_remaining;
+    }
+    UINT length_read;
+    if (f_read(&self->file->fp, buffer, num_bytes_to_load, &length_read) != FR_OK || length_read != num_bytes_to_load) {
+        return false;
+    }
+    self->bytes_remaining -= length_read;
+    // Pad the last buffer to word align it.
+    if (self->bytes_remaining == 0 && length_read % sizeof(uint32_t) != 0) {
+        uint32_t pad = sizeof(uint32_t) - length_read % sizeof(uint32_t);
+        length_read += pad;
+        if (self->bits_per_sample == 8) {
+            for (uint32_t i = 0; i < pad; i++) {
+                buffer[length_read / sizeof(uint8_t) - i - 1] = 0x80;
+            }
+        } else if (self->bits_per_sample == 16) {
+            // We know the buffer is aligned because len is a multiple of the word size.
+            #pragma GCC diagnostic push
+            #pragma GCC diagnostic ignored "-Wcast-align"
+            ((int16_t*) buffer)[length_read / sizeof(int16_t) - 1] = 0;
+            #pragma GCC diagnostic pop
+        }
+    }
+    self->buffer_data[slot] = buffer;
+    self->buffer_lengths[slot] = length_read;
+    self->loaded += 1;
+    return true;
+}
+
+void audioio_wavefile_prefetch(audioio_wavefile_obj_t* self) {
+    // The last two buffers given out may still be playing, and a third when
+    // the two channels play from separate DMA channels and one lags behind,
+    // so only the other slots can be read into.
+    if (self->buffer == NULL || self->bytes_remaining == 0 ||
+        self->loaded - self->buffer_index + 3 >= self->buffer_count) {
+        return;
+    }
+    // Read one buffer at a time to keep each background task short.
+    audioio_wavefile_load_buffer(self);
 }
 
 audioio_get_buffer_result_t audioio_wavefile_get_buffer(audioio_wavefile_obj_t* self,
@@ -199,61 +349,32 @@ audioio_get_buffer_result_t audioio_wavefile_get_buffer(audioio_wavefile_obj_t*
 
     bool need_more_data = self->read_count == channel_read_count;
 
-    if (self->bytes_remaining == 0 && need_more_data) {
+    if (self->bytes_remaining == 0 && self->loaded == self->buffer_index && need_more_data) {
         *buffer = NULL;
         *buffer_length = 0;
         return GET_BUFFER_DONE;
     }
 
     if (need_more_data) {
-        uint16_t num_bytes_to_load = self->len;
-        if (num_bytes_to_load > self->bytes_remaining) {
-            num_bytes_to_load = self->bytes_remaining;
-        }
-        UINT length_read;
-        if (self->buffer_index % 2 == 1) {
-            *buffer = self->second_buffer;
-        } else {
-            *buffer = self->buffer;
-        }
-        if (f_read(&self->file->fp, *buffer, num_bytes_to_load, &length_read) != FR_OK || length_read != num_bytes_to_load) {
-            return GET_BUFFER_ERROR;
-        }
-        self->bytes_remaining -= length_read;
-        // Pad the last buffer to word align it.
-        if (self->bytes_remaining == 0 && length_read % sizeof(uint32_t) != 0) {
-            uint32_t pad = length_read % sizeof(uint32_t);
-            length_read += pad;
-            if (self->bits_per_sample == 8) {
-                for (uint32_t i = 0; i < pad; i++) {
-                    ((uint8_t*) (*buffer))[length_read / sizeof(uint8_t) - i - 1] = 0x80;
-                }
-            } else if (self->bits_per_sample == 16) {
-                // We know the buffer is aligned because we allocated it onto the heap ourselves.
-                #pragma GCC diagnostic push
-                #pragma GCC diagnostic ignored "-Wcast-align"
-                ((int16_t*) (*buffer))[length_read / sizeof(int16_t) - 1] = 0;
-                #pragma GCC diagnostic pop
+        if (self->loaded == self->buffer_index) {
+            // Nothing has been read ahead so read from the file now. This is
+            // expected for the first buffers after a reset.
+            if (self->fragments == NULL && self->buffer_index - self->reset_index >= 2) {
+                self->underruns += 1;
+            }
+            if (!audioio_wavefile_load_buffer(self)) {
+                return GET_BUFFER_ERROR;
             }
-        }
-        *buffer_length = length_read;
-        if (self->buffer_index % 2 == 1) {
-            self->second_buffer_length = length_read;
-        } else {
-            self->buffer_length = length_read;
         }
         self->buffer_index += 1;
         self->read_count += 1;
     }
 
     uint32_t buffers_back = self->read_count - 1 - channel_read_count;
-    if ((self->buffer_index - buffers_back) % 2 == 0) {
-        *buffer = self->second_buffer;
-        *buffer_length = self->second_buffer_length;
-    } else {
-        *buffer = self->buffer;
-        *buffer_length = self->buffer_length;
-    }
+    uint32_t slot = (self->buffer_index - 1 - buffers_back) % self->buffer_count;
+    // Buffers played from flash are never written to.
+    *buffer = (uint8_t*) self->buffer_data[slot];
+    *buffer_length = self->buffer_lengths[slot];
 
     if (channel == 0) {
         self->left_read_count += 1;
@@ -262,7 +383,10 @@ audioio_get_buffer_result_t audioio_wavefile_get_buffer(audioio_wavefile_obj_t*
         *buffer = *buffer + self->bits_per_sample / 8;
     }
 
-    return self->bytes_remaining == 0 ? GET_BUFFER_DONE : GET_BUFFER_MORE_DATA;
+    if (self->bytes_remaining == 0 && self->loaded == self->buffer_index) {
+        return GET_BUFFER_DONE;
+    }
+    return GET_BUFFER_MORE_DATA;
 }
 
 void audioio_wavefile_get_buffer_structure(audioio_wavefile_obj_t* self, bool single_channel,
@@ -270,7 +394,7 @@ void audioio_wavefile_get_buffer_structure(audioio_wavefile_obj_t* self, bool si
                                            uint32_t* max_buffer_length, uint8_t* spacing) {
     *single_buffer = false;
     *samples_signed = self->bits_per_sample > 8;
-    *max_buffer_length = 512;
+    *max_buffer_length = self->len;
     if (single_channel) {
         *spacing = self->channel_count;
     } else {
@@ -32,16 +32,37 @@
 
 #include "shared-module/audiocore/__init__.h"
 
+// Most buffers a WaveFile can read ahead into.
+#define AUDIOIO_WAVEFILE_MAX_BUFFERS 8
+// Most pieces a file played straight from flash can be in.
+#define AUDIOIO_WAVEFILE_MAX_FRAGMENTS 8
+
+// A contiguous run of the sample data in memory mapped flash.
+typedef struct {
+    const uint8_t* data;
+    uint32_t length;
+} audioio_wavefile_fragment_t;
+
 typedef struct {
     mp_obj_base_t base;
-    uint8_t* buffer;
-    uint32_t buffer_length;
-    uint8_t* second_buffer;
-    uint32_t second_buffer_length;
+    uint8_t* buffer; // buffer_count buffers of len bytes each
+    const uint8_t* buffer_data[AUDIOIO_WAVEFILE_MAX_BUFFERS];
+    uint32_t buffer_lengths[AUDIOIO_WAVEFILE_MAX_BUFFERS];
+    uint8_t buffer_count;
+    // Set instead of buffer when the data is played straight from flash.
+    audioio_wavefile_fragment_t* fragments;
+    uint8_t fragment_count;
+    uint8_t fragment; // The fragment the next buffer starts in
+    uint32_t fragment_offset;
     uint32_t file_length; // In bytes
     uint16_t data_start; // Where the data values start
     uint8_t bits_per_sample;
-    uint16_t buffer_index;
+    // Buffers are numbered in the order they are read from the file and
+    // buffer n is kept in slot n % buffer_count.
+    uint32_t buffer_index; // Number of buffers given out by get_buffer
+    uint32_t loaded; // Number of buffers read from the file
+    uint32_t reset_index; // buffer_index when playback last started
+    uint32_t underruns;
     uint32_t bytes_remaining;
 
     uint8_t channel_count;
@@ -67,5 +88,6 @@ audioio_get_buffer_result_t audioio_wavefile_get_buffer(audioio_wavefile_obj_t*
 void audioio_wavefile_get_buffer_structure(audioio_wavefile_obj_t* self, bool single_channel,
                                            bool* single_buffer, bool* samples_signed,
                                            uint32_t* max_buffer_length, uint8_t* spacing);
+void audioio_wavefile_prefetch(audioio_wavefile_obj_t* self);
 
 #endif // MICROPY_INCLUDED_SHARED_MODULE_AUDIOIO_WAVEFILE_H
@@ -70,3 +70,10 @@ void audiosample_get_buffer_structure(mp_obj_t sample_obj, bool single_channel,
     proto->get_buffer_structure(MP_OBJ_TO_PTR(sample_obj), single_channel, single_buffer,
         samples_signed, max_buffer_length, spacing);
 }
+
+void audiosample_prefetch(mp_obj_t sample_obj) {
+    const audiosample_p_t *proto = mp_proto_get(MP_QSTR_protocol_audiosample, sample_obj);
+    if (proto != NULL && proto->prefetch != NULL) {
+        proto->prefetch(MP_OBJ_TO_PTR(sample_obj));
+    }
+}
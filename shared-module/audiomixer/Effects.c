@@ -0,0 +1,473 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "shared-bindings/audiomixer/Effects.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "py/runtime.h"
+#include "shared-module/audiocore/__init__.h"
+#include "shared-module/audiomixer/dsp.h"
+
+#if CIRCUITPY_AUDIOMIXER_BENCHMARK
+#include "shared-bindings/microcontroller/__init__.h"
+#endif
+
+void common_hal_audiomixer_effects_construct(audiomixer_effects_obj_t* self,
+                                             mp_obj_t sample,
+                                             uint32_t buffer_size,
+                                             uint32_t max_delay) {
+    uint8_t channel_count = audiosample_channel_count(sample);
+    uint8_t bits_per_sample = audiosample_bits_per_sample(sample);
+    if (channel_count < 1 || channel_count > 2) {
+        mp_raise_ValueError(translate("Invalid channel count"));
+    }
+    if (bits_per_sample != 8 && bits_per_sample != 16) {
+        mp_raise_ValueError(translate("bits_per_sample must be 8 or 16"));
+    }
+    bool single_buffer;
+    uint32_t max_buffer_length;
+    uint8_t spacing;
+    audiosample_get_buffer_structure(sample, false, &single_buffer, &self->sample_signed,
+                                     &max_buffer_length, &spacing);
+    self->sample = sample;
+    self->channel_count = channel_count;
+    self->sample_rate = audiosample_sample_rate(sample);
+    self->sample_bits_per_sample = bits_per_sample;
+
+    self->len = buffer_size / 2 / sizeof(uint32_t) * sizeof(uint32_t);
+
+    self->first_buffer = m_malloc(self->len, false);
+    if (self->first_buffer == NULL) {
+        common_hal_audiomixer_effects_deinit(self);
+        mp_raise_msg(&mp_type_MemoryError, translate("Couldn't allocate first buffer"));
+    }
+
+    self->second_buffer = m_malloc(self->len, false);
+    if (self->second_buffer == NULL) {
+        common_hal_audiomixer_effects_deinit(self);
+        mp_raise_msg(&mp_type_MemoryError, translate("Couldn't allocate second buffer"));
+    }
+
+    self->max_delay = max_delay;
+    if (max_delay > 0) {
+        self->delay_line = m_malloc((max_delay * channel_count + 1) / 2 * sizeof(uint32_t), false);
+    }
+
+    self->gain = 1 << 15;
+    self->ramp_gain = self->gain;
+    self->filter = false;
+    self->limit = INT16_MAX;
+    self->delay = 0;
+    self->feedback = 0;
+    self->mix = 1 << 14;
+
+    audiomixer_effects_reset_buffer(self, false, 0);
+}
+
+void common_hal_audiomixer_effects_deinit(audiomixer_effects_obj_t* self) {
+    self->first_buffer = NULL;
+    self->second_buffer = NULL;
+    self->delay_line = NULL;
+    self->delay = 0;
+    self->sample = MP_OBJ_NULL;
+}
+
+bool common_hal_audiomixer_effects_deinited(audiomixer_effects_obj_t* self) {
+    return self->first_buffer == NULL;
+}
+
+uint32_t common_hal_audiomixer_effects_get_sample_rate(audiomixer_effects_obj_t* self) {
+    return self->sample_rate;
+}
+
+uint8_t common_hal_audiomixer_effects_get_channel_count(audiomixer_effects_obj_t* self) {
+    return self->channel_count;
+}
+
+uint8_t common_hal_audiomixer_effects_get_bits_per_sample(audiomixer_effects_obj_t* self) {
+    return 16;
+}
+
+float common_hal_audiomixer_effects_get_gain(audiomixer_effects_obj_t* self) {
+    return (float) self->gain / (1 << 15);
+}
+
+void common_hal_audiomixer_effects_set_gain(audiomixer_effects_obj_t* self, float gain) {
+    self->gain = gain * (1 << 15);
+}
+
+bool common_hal_audiomixer_effects_get_filter(audiomixer_effects_obj_t* self, float coefficients[5]) {
+    if (!self->filter) {
+        return false;
+    }
+    coefficients[0] = (float) self->filter_b0 / (1 << 14);
+    coefficients[1] = (float) (int16_t) self->filter_b / (1 << 14);
+    coefficients[2] = (float) (int16_t) (self->filter_b >> 16) / (1 << 14);
+    coefficients[3] = (float) -(int16_t) self->filter_a / (1 << 14);
+    coefficients[4] = (float) -(int16_t) (self->filter_a >> 16) / (1 << 14);
+    return true;
+}
+
+void common_hal_audiomixer_effects_set_filter(audiomixer_effects_obj_t* self, const float* coefficients) {
+    if (coefficients == NULL) {
+        self->filter = false;
+        return;
+    }
+    int16_t q[5];
+    for (size_t i = 0; i < 5; i++) {
+        q[i] = coefficients[i] * (1 << 14);
+    }
+    // Stop the filter while it changes so the interrupt doesn't see half of it.
+    self->filter = false;
+    self->filter_b0 = q[0];
+    self->filter_b = ((uint32_t) (uint16_t) q[2] << 16) | (uint16_t) q[1];
+    self->filter_a = ((uint32_t) (uint16_t) -q[4] << 16) | (uint16_t) -q[3];
+    memset(self->filter_x, 0, sizeof(self->filter_x));
+    memset(self->filter_y, 0, sizeof(self->filter_y));
+    self->filter = true;
+}
+
+float common_hal_audiomixer_effects_get_limit(audiomixer_effects_obj_t* self) {
+    return (float) self->limit / INT16_MAX;
+}
+
+void common_hal_audiomixer_effects_set_limit(audiomixer_effects_obj_t* self, float limit) {
+    self->limit = limit * INT16_MAX;
+}
+
+uint32_t common_hal_audiomixer_effects_get_delay(audiomixer_effects_obj_t* self) {
+    return self->delay;
+}
+
+uint32_t common_hal_audiomixer_effects_get_max_delay(audiomixer_effects_obj_t* self) {
+    return self->max_delay;
+}
+
+void common_hal_audiomixer_effects_set_delay(audiomixer_effects_obj_t* self, uint32_t delay) {
+    // Stop the delay while the line is cleared.
+    self->delay = 0;
+    uint32_t words = (delay * self->channel_count + 1) / 2;
+    if (words > 0) {
+        memset(self->delay_line, 0, words * sizeof(uint32_t));
+    }
+    self->delay_words = words;
+    self->delay_pos = 0;
+    self->delay = delay;
+}
+
+float common_hal_audiomixer_effects_get_feedback(audiomixer_effects_obj_t* self) {
+    return (float) self->feedback / (1 << 15);
+}
+
+void common_hal_audiomixer_effects_set_feedback(audiomixer_effects_obj_t* self, float feedback) {
+    self->feedback = MIN(feedback * (1 << 15), INT16_MAX);
+}
+
+float common_hal_audiomixer_effects_get_mix(audiomixer_effects_obj_t* self) {
+    return (float) self->mix / (1 << 15);
+}
+
+void common_hal_audiomixer_effects_set_mix(audiomixer_effects_obj_t* self, float mix) {
+    self->mix = MIN(mix * (1 << 15), INT16_MAX);
+}
+
+void audiomixer_effects_reset_buffer(audiomixer_effects_obj_t* self,
+                                     bool single_channel,
+                                     uint8_t channel) {
+    if (single_channel && channel == 1) {
+        return;
+    }
+    audiosample_reset_buffer(self->sample, false, 0);
+    self->sample_length = 0;
+    self->more_data = true;
+    self->done = false;
+    self->read_count = 0;
+    self->left_read_count = 0;
+    self->right_read_count = 0;
+    memset(self->filter_x, 0, sizeof(self->filter_x));
+    memset(self->filter_y, 0, sizeof(self->filter_y));
+    if (self->delay > 0) {
+        memset(self->delay_line, 0, self->delay_words * sizeof(uint32_t));
+        self->delay_pos = 0;
+    }
+}
+
+// Reads up to count samples from the wrapped sample as signed 16 bit values.
+// Returns the number read, which is short only at the end of the sample.
+static uint32_t read_samples(audiomixer_effects_obj_t* self, int16_t* out, uint32_t count) {
+    uint8_t bytes_per_sample = self->sample_bits_per_sample / 8;
+    uint32_t n_read = 0;
+    while (n_read < count) {
+        if (self->sample_length < bytes_per_sample) {
+            if (!self->more_data) {
+                break;
+            }
+            audioio_get_buffer_result_t result = audiosample_get_buffer(self->sample, false, 0, &self->sample_buffer, &self->sample_length);
+            self->more_data = result == GET_BUFFER_MORE_DATA;
+            if (result == GET_BUFFER_ERROR) {
+                self->sample_length = 0;
+                break;
+            }
+            continue;
+        }
+        uint32_t n = MIN(count - n_read, self->sample_length / bytes_per_sample);
+        if (bytes_per_sample == 2) {
+            uint16_t* src = (uint16_t*) self->sample_buffer;
+            if (self->sample_signed) {
+                memcpy(out + n_read, src, n * sizeof(int16_t));
+            } else {
+                for (uint32_t i = 0; i < n; i++) {
+                    out[n_read + i] = src[i] - 0x8000;
+                }
+            }
+        } else {
+            uint8_t* src = self->sample_buffer;
+            int16_t offset = self->sample_signed ? 0 : 0x80;
+            for (uint32_t i = 0; i < n; i++) {
+                out[n_read + i] = ((int8_t) (src[i] - offset)) * 256;
+            }
+        }
+        self->sample_buffer += n * bytes_per_sample;
+        self->sample_length -= n * bytes_per_sample;
+        n_read += n;
+    }
+    return n_read;
+}
+
+// Each stage processes a block of samples in place.
+
+static void apply_gain(audiomixer_effects_obj_t* self, uint32_t* word_buffer, uint32_t length) {
+    if (self->ramp_gain == self->gain) {
+        for (uint32_t i = 0; i < length; i++) {
+            word_buffer[i] = mult16signed(word_buffer[i], self->gain);
+        }
+        return;
+    }
+    // Ramp linearly to the new gain over the block, in Q8 steps.
+    int32_t gain = self->ramp_gain << 8;
+    int32_t step = (((int32_t) self->gain - self->ramp_gain) << 8) / (int32_t) MAX(length, 1);
+    for (uint32_t i = 0; i < length; i++) {
+        word_buffer[i] = mult16signed(word_buffer[i], MIN(gain >> 8, INT16_MAX));
+        gain += step;
+    }
+    self->ramp_gain = self->gain;
+}
+
+static void apply_filter(audiomixer_effects_obj_t* self, int16_t* samples, uint32_t count) {
+    uint8_t channel_count = self->channel_count;
+    for (uint8_t c = 0; c < channel_count; c++) {
+        uint32_t x = self->filter_x[c];
+        uint32_t y = self->filter_y[c];
+        for (uint32_t i = c; i < count; i += channel_count) {
+            int64_t acc = (int32_t) self->filter_b0 * samples[i];
+            acc = __SMLALD(x, self->filter_b, acc);
+            acc = __SMLALD(y, self->filter_a, acc);
+            acc >>= 14;
+            int16_t out = acc > INT16_MAX ? INT16_MAX : (acc < INT16_MIN ? INT16_MIN : acc);
+            // The newest input and output are in the low halves.
+            x = (x << 16) | (uint16_t) samples[i];
+            y = (y << 16) | (uint16_t) out;
+            samples[i] = out;
+        }
+        self->filter_x[c] = x;
+        self->filter_y[c] = y;
+    }
+}
+
+static void apply_delay(audiomixer_effects_obj_t* self, uint32_t* word_buffer, uint32_t length) {
+    uint32_t* line = self->delay_line;
+    uint32_t pos = self->delay_pos;
+    for (uint32_t i = 0; i < length; i++) {
+        uint32_t delayed = line[pos];
+        uint32_t word = word_buffer[i];
+        word_buffer[i] = add16signed(word, mult16signed(delayed, self->mix));
+        line[pos] = add16signed(word, mult16signed(delayed, self->feedback));
+        if (++pos == self->delay_words) {
+            pos = 0;
+        }
+    }
+    self->delay_pos = pos;
+}
+
+// Compresses samples above the threshold so that they approach full scale
+// without reaching it.
+static void apply_limit(audiomixer_effects_obj_t* self, int16_t* samples, uint32_t count) {
+    int32_t threshold = self->limit;
+    int32_t headroom = INT16_MAX - threshold;
+    for (uint32_t i = 0; i < count; i++) {
+        int32_t sample = samples[i];
+        int32_t magnitude = sample < 0 ? -sample : sample;
+        if (magnitude > threshold) {
+            int32_t over = magnitude - threshold;
+            magnitude = threshold + over * headroom / (headroom + over);
+            samples[i] = sample < 0 ? -magnitude : magnitude;
+        }
+    }
+}
+
+audioio_get_buffer_result_t audiomixer_effects_get_buffer(audiomixer_effects_obj_t* self,
+                                                          bool single_channel,
+                                                          uint8_t channel,
+                                                          uint8_t** buffer,
+                                                          uint32_t* buffer_length) {
+    if (!single_channel) {
+        channel = 0;
+    }
+
+    uint32_t channel_read_count = self->left_read_count;
+    if (channel == 1) {
+        channel_read_count = self->right_read_count;
+    }
+
+    bool need_more_data = self->read_count == channel_read_count;
+    if (need_more_data) {
+        uint32_t* word_buffer;
+        if (self->use_first_buffer) {
+            word_buffer = self->first_buffer;
+        } else {
+            word_buffer = self->second_buffer;
+        }
+        self->use_first_buffer = !self->use_first_buffer;
+        int16_t* samples = (int16_t*) word_buffer;
+
+        uint32_t count = read_samples(self, samples, self->len / sizeof(int16_t));
+        // Pad a mono sample out to a whole word.
+        uint32_t length = (count + 1) / 2;
+        if (count % 2 == 1) {
+            samples[count] = 0;
+        }
+
+        if (self->gain != 1 << 15 || self->ramp_gain != self->gain) {
+            apply_gain(self, word_buffer, length);
+        }
+        if (self->filter) {
+            apply_filter(self, samples, count);
+        }
+        if (self->delay > 0) {
+            apply_delay(self, word_buffer, length);
+        }
+        if (self->limit < INT16_MAX) {
+            apply_limit(self, samples, count);
+        }
+
+        self->buffer_length = count * sizeof(int16_t);
+        self->done = self->sample_length == 0 && !self->more_data;
+        self->read_count += 1;
+    }
+
+    // The buffer filled last, by this call or the other channel's.
+    if (self->use_first_buffer) {
+        *buffer = (uint8_t*) self->second_buffer;
+    } else {
+        *buffer = (uint8_t*) self->first_buffer;
+    }
+    *buffer_length = self->buffer_length;
+
+    if (channel == 0) {
+        self->left_read_count += 1;
+    } else if (channel == 1) {
+        self->right_read_count += 1;
+        *buffer = *buffer + sizeof(int16_t);
+    }
+    if (self->done) {
+        return GET_BUFFER_DONE;
+    }
+    return GET_BUFFER_MORE_DATA;
+}
+
+#if CIRCUITPY_AUDIOMIXER_BENCHMARK
+// Runs the whole sample through the stages that are on, a buffer at a time,
+// and counts the cycles in each with the DWT cycle counter. Interrupts are off
+// while the stages run so that only reading the sample can be interrupted.
+uint32_t common_hal_audiomixer_effects_benchmark(audiomixer_effects_obj_t* self,
+                                                 uint32_t cycles[AUDIOMIXER_EFFECTS_STAGE_COUNT]) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    audiomixer_effects_reset_buffer(self, false, 0);
+    uint32_t* word_buffer = self->first_buffer;
+    int16_t* samples = (int16_t*) word_buffer;
+    uint32_t total = 0;
+    while (true) {
+        uint32_t start = DWT->CYCCNT;
+        uint32_t count = read_samples(self, samples, self->len / sizeof(int16_t));
+        cycles[AUDIOMIXER_EFFECTS_READ] += DWT->CYCCNT - start;
+        if (count == 0) {
+            break;
+        }
+        uint32_t length = (count + 1) / 2;
+        if (count % 2 == 1) {
+            samples[count] = 0;
+        }
+
+        common_hal_mcu_disable_interrupts();
+        if (self->gain != 1 << 15 || self->ramp_gain != self->gain) {
+            start = DWT->CYCCNT;
+            apply_gain(self, word_buffer, length);
+            cycles[AUDIOMIXER_EFFECTS_GAIN] += DWT->CYCCNT - start;
+        }
+        if (self->filter) {
+            start = DWT->CYCCNT;
+            apply_filter(self, samples, count);
+            cycles[AUDIOMIXER_EFFECTS_FILTER] += DWT->CYCCNT - start;
+        }
+        if (self->delay > 0) {
+            start = DWT->CYCCNT;
+            apply_delay(self, word_buffer, length);
+            cycles[AUDIOMIXER_EFFECTS_DELAY] += DWT->CYCCNT - start;
+        }
+        if (self->limit < INT16_MAX) {
+            start = DWT->CYCCNT;
+            apply_limit(self, samples, count);
+            cycles[AUDIOMIXER_EFFECTS_LIMIT] += DWT->CYCCNT - start;
+        }
+        common_hal_mcu_enable_interrupts();
+        total += count;
+    }
+    audiomixer_effects_reset_buffer(self, false, 0);
+    return total;
+}
+#endif
+
+void audiomixer_effects_prefetch(audiomixer_effects_obj_t* self) {
+    if (self->sample != MP_OBJ_NULL) {
+        audiosample_prefetch(self->sample);
+    }
+}
+
+void audiomixer_effects_get_buffer_structure(audiomixer_effects_obj_t* self, bool single_channel,
+                                             bool* single_buffer, bool* samples_signed,
+                                             uint32_t* max_buffer_length, uint8_t* spacing) {
+    *single_buffer = false;
+    *samples_signed = true;
+    *max_buffer_length = self->len;
+    if (single_channel) {
+        *spacing = self->channel_count;
+    } else {
+        *spacing = 1;
+    }
+}
@@ -0,0 +1,106 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef MICROPY_INCLUDED_SHARED_MODULE_AUDIOMIXER_EFFECTS_H
+#define MICROPY_INCLUDED_SHARED_MODULE_AUDIOMIXER_EFFECTS_H
+
+#include "py/obj.h"
+
+#include "shared-module/audiocore/__init__.h"
+
+typedef struct {
+    mp_obj_base_t base;
+    mp_obj_t sample;
+    uint32_t* first_buffer;
+    uint32_t* second_buffer;
+    uint32_t len; // in bytes
+    uint32_t buffer_length; // in bytes, of the buffer filled last
+    bool use_first_buffer;
+    bool done;
+    uint8_t channel_count;
+    uint32_t sample_rate;
+
+    uint8_t sample_bits_per_sample;
+    bool sample_signed;
+    uint8_t* sample_buffer;
+    uint32_t sample_length; // in bytes
+    bool more_data;
+
+    uint32_t read_count;
+    uint32_t left_read_count;
+    uint32_t right_read_count;
+
+    // Gain in Q15. Changes ramp from ramp_gain over one buffer.
+    uint16_t gain;
+    uint16_t ramp_gain;
+
+    // Biquad filter coefficients in Q14, with b1/b2 and -a1/-a2 packed in
+    // pairs, and each channel's last two inputs and outputs packed likewise.
+    bool filter;
+    int16_t filter_b0;
+    uint32_t filter_b;
+    uint32_t filter_a;
+    uint32_t filter_x[2];
+    uint32_t filter_y[2];
+
+    // Soft limiter threshold in Q15. INT16_MAX disables it.
+    int16_t limit;
+
+    // Delay line of whole words, so mono delays are rounded up to an even
+    // number of frames.
+    uint32_t* delay_line;
+    uint32_t max_delay; // in frames
+    uint32_t delay; // in frames
+    uint32_t delay_words;
+    uint32_t delay_pos;
+    uint16_t feedback; // Q15
+    uint16_t mix; // Q15
+} audiomixer_effects_obj_t;
+
+// Parts of the work timed by common_hal_audiomixer_effects_benchmark().
+enum {
+    AUDIOMIXER_EFFECTS_READ,
+    AUDIOMIXER_EFFECTS_GAIN,
+    AUDIOMIXER_EFFECTS_FILTER,
+    AUDIOMIXER_EFFECTS_DELAY,
+    AUDIOMIXER_EFFECTS_LIMIT,
+    AUDIOMIXER_EFFECTS_STAGE_COUNT,
+};
+
+// These are not available from Python because it may be called in an interrupt.
+void audiomixer_effects_reset_buffer(audiomixer_effects_obj_t* self,
+                                     bool single_channel,
+                                     uint8_t channel);
+audioio_get_buffer_result_t audiomixer_effects_get_buffer(audiomixer_effects_obj_t* self,
+                                                          bool single_channel,
+                                                          uint8_t channel,
+                                                          uint8_t** buffer,
+                                                          uint32_t* buffer_length); // length in bytes
+void audiomixer_effects_get_buffer_structure(audiomixer_effects_obj_t* self, bool single_channel,
+                                             bool* single_buffer, bool* samples_signed,
+                                             uint32_t* max_buffer_length, uint8_t* spacing);
+void audiomixer_effects_prefetch(audiomixer_effects_obj_t* self);
+
+#endif // MICROPY_INCLUDED_SHARED_MODULE_AUDIOMIXER_EFFECTS_H
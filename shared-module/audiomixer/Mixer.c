@@ -30,10 +30,12 @@
 #include "shared-bindings/audiomixer/MixerVoice.h"
 
 #include <stdint.h>
+#include <string.h>
 
 #include "py/runtime.h"
 #include "shared-module/audiocore/__init__.h"
 #include "shared-module/audiocore/RawSample.h"
+#include "shared-module/audiomixer/dsp.h"
 
 void common_hal_audiomixer_mixer_construct(audiomixer_mixer_obj_t* self,
                                            uint8_t voice_count,
@@ -41,7 +43,8 @@ void common_hal_audiomixer_mixer_construct(audiomixer_mixer_obj_t* self,
                                            uint8_t bits_per_sample,
                                            bool samples_signed,
                                            uint8_t channel_count,
-                                           uint32_t sample_rate) {
+                                           uint32_t sample_rate,
+                                           bool polyphase) {
     self->len = buffer_size / 2 / sizeof(uint32_t) * sizeof(uint32_t);
 
     self->first_buffer = m_malloc(self->len, false);
@@ -60,6 +63,7 @@ void common_hal_audiomixer_mixer_construct(audiomixer_mixer_obj_t* self,
     self->samples_signed = samples_signed;
     self->channel_count = channel_count;
     self->sample_rate = sample_rate;
+    self->polyphase = polyphase;
     self->voice_count = voice_count;
 }
 
@@ -101,25 +105,6 @@ void audiomixer_mixer_reset_buffer(audiomixer_mixer_obj_t* self,
     }
 }
 
-__attribute__((always_inline))
-static inline uint32_t add16signed(uint32_t a, uint32_t b) {
-    return __QADD16(a, b);
-}
-
-__attribute__((always_inline))
-static inline uint32_t mult16signed(uint32_t val, int32_t mul) {
-    mul <<= 16;
-    int32_t hi, lo;
-    enum { bits = 16 }; // saturate to 16 bits
-    enum { shift = 15 }; // shift is done automatically
-    asm volatile("smulwb %0, %1, %2" : "=r" (lo) : "r" (mul), "r" (val));
-    asm volatile("smulwt %0, %1, %2" : "=r" (hi) : "r" (mul), "r" (val));
-    asm volatile("ssat %0, %1, %2, asr %3" : "=r" (lo) : "I" (bits), "r" (lo), "I" (shift));
-    asm volatile("ssat %0, %1, %2, asr %3" : "=r" (hi) : "I" (bits), "r" (hi), "I" (shift));
-    asm volatile("pkhbt %0, %1, %2, lsl #16" : "=r" (val) : "r" (lo), "r" (hi)); // pack
-    return val;
-}
-
 static inline uint32_t tounsigned8(uint32_t val) {
     return __UADD8(val, 0x80808080);
 }
@@ -140,9 +125,32 @@ static inline uint32_t pack8(uint32_t val) {
     return ((val & 0xff000000) >> 16) | ((val & 0xff00) >> 8);
 }
 
+// Returns the change in level at each step of a ramp to the voice's level
+// over length steps.
+static int32_t level_ramp_step(audiomixer_mixervoice_obj_t* voice, uint32_t length) {
+    int32_t step = ((int32_t) voice->level - voice->ramp_level) / (int32_t) MAX(length, 1);
+    if (step == 0) {
+        step = voice->level > voice->ramp_level ? 1 : -1;
+    }
+    return step;
+}
+
+static void advance_level_ramp(audiomixer_mixervoice_obj_t* voice, int32_t step) {
+    int32_t level = voice->ramp_level + step;
+    if ((step > 0 && level > voice->level) || (step < 0 && level < voice->level)) {
+        level = voice->level;
+    }
+    voice->ramp_level = level;
+}
+
 static void mix_down_one_voice(audiomixer_mixer_obj_t* self,
         audiomixer_mixervoice_obj_t* voice, bool voices_active,
         uint32_t* word_buffer, uint32_t length) {
+    // Level changes are spread over the buffer a few words at a time.
+    int32_t ramp_step = 0;
+    if (voice->ramp_level != voice->level) {
+        ramp_step = level_ramp_step(voice, length / AUDIOMIXER_RAMP_WORDS);
+    }
     while (length != 0) {
         if (voice->buffer_length == 0) {
             if (!voice->more_data) {
@@ -163,8 +171,12 @@ static void mix_down_one_voice(audiomixer_mixer_obj_t* self,
         }
 
         uint32_t n = MIN(voice->buffer_length, length);
+        if (voice->ramp_level != voice->level) {
+            n = MIN(n, AUDIOMIXER_RAMP_WORDS);
+        }
         uint32_t *src = voice->remaining_buffer;
-        uint16_t level = voice->level;
+        // mult16signed() can't represent 1.0 and would invert the sample.
+        uint16_t level = MIN(voice->ramp_level, INT16_MAX);
 
         // First active voice gets copied over verbatim.
         if (!voices_active) {
@@ -225,6 +237,9 @@ static void mix_down_one_voice(audiomixer_mixer_obj_t* self,
         word_buffer += n;
         voice->remaining_buffer += n;
         voice->buffer_length -= n;
+        if (voice->ramp_level != voice->level) {
+            advance_level_ramp(voice, ramp_step);
+        }
     }
 
     if (length && !voices_active) {
@@ -234,6 +249,159 @@ static void mix_down_one_voice(audiomixer_mixer_obj_t* self,
     }
 }
 
+// Kaiser windowed sinc (beta 5, cutoff 0.9 of Nyquist) in 32 phases of 8 taps,
+// in Q14. Taps are ordered oldest frame first and each phase sums to 1.0.
+static const int16_t polyphase_coefficients[32][AUDIOMIXER_HISTORY_LEN] = {
+    {323, -844, 1393, 14685, 1393, -844, 323, -45},
+    {287, -713, 970, 14670, 1840, -977, 359, -52},
+    {252, -584, 571, 14612, 2308, -1111, 394, -58},
+    {217, -459, 197, 14512, 2797, -1245, 429, -64},
+    {183, -338, -152, 14372, 3303, -1376, 462, -70},
+    {150, -223, -474, 14190, 3826, -1503, 494, -76},
+    {119, -114, -768, 13968, 4363, -1626, 523, -81},
+    {90, -11, -1036, 13708, 4912, -1742, 549, -86},
+    {63, 85, -1276, 13412, 5470, -1851, 571, -90},
+    {37, 173, -1488, 13079, 6035, -1949, 590, -93},
+    {14, 253, -1673, 12714, 6604, -2037, 604, -95},
+    {-7, 325, -1831, 12318, 7175, -2112, 612, -96},
+    {-25, 389, -1962, 11891, 7743, -2172, 616, -96},
+    {-42, 445, -2068, 11439, 8308, -2217, 613, -94},
+    {-56, 492, -2149, 10962, 8865, -2243, 603, -90},
+    {-67, 531, -2205, 10462, 9412, -2252, 587, -84},
+    {-77, 563, -2239, 9945, 9945, -2239, 563, -77},
+    {-84, 587, -2252, 9412, 10462, -2205, 531, -67},
+    {-90, 603, -2243, 8865, 10962, -2149, 492, -56},
+    {-94, 613, -2217, 8308, 11439, -2068, 445, -42},
+    {-96, 616, -2172, 7743, 11891, -1962, 389, -25},
+    {-96, 612, -2112, 7175, 12318, -1831, 325, -7},
+    {-95, 604, -2037, 6604, 12714, -1673, 253, 14},
+    {-93, 590, -1949, 6035, 13079, -1488, 173, 37},
+    {-90, 571, -1851, 5470, 13412, -1276, 85, 63},
+    {-86, 549, -1742, 4912, 13708, -1036, -11, 90},
+    {-81, 523, -1626, 4363, 13968, -768, -114, 119},
+    {-76, 494, -1503, 3826, 14190, -474, -223, 150},
+    {-70, 462, -1376, 3303, 14372, -152, -338, 183},
+    {-64, 429, -1245, 2797, 14512, 197, -459, 217},
+    {-58, 394, -1111, 2308, 14612, 571, -584, 252},
+    {-52, 359, -977, 1840, 14670, 970, -713, 287},
+};
+
+static inline int32_t saturate16(int32_t val) {
+    if (val > INT16_MAX) {
+        return INT16_MAX;
+    } else if (val < INT16_MIN) {
+        return INT16_MIN;
+    }
+    return val;
+}
+
+// Reads the next frame of a converted voice into its history, in the mixer's
+// channel count. Returns false once the sample has ended and the voice stops.
+static bool read_frame(audiomixer_mixer_obj_t* self, audiomixer_mixervoice_obj_t* voice) {
+    uint8_t bytes_per_sample = voice->sample_bits_per_sample / 8;
+    uint32_t frame_length = voice->sample_channel_count * bytes_per_sample;
+    if (voice->convert_length < frame_length) {
+        if (!voice->more_data) {
+            if (voice->loop) {
+                audiosample_reset_buffer(voice->sample, false, 0);
+            } else {
+                voice->sample = NULL;
+                return false;
+            }
+        }
+        audioio_get_buffer_result_t result = audiosample_get_buffer(voice->sample, false, 0, &voice->convert_buffer, &voice->convert_length);
+        voice->more_data = result == GET_BUFFER_MORE_DATA;
+        if (result == GET_BUFFER_ERROR || voice->convert_length < frame_length) {
+            voice->sample = NULL;
+            return false;
+        }
+    }
+
+    int32_t samples[2];
+    for (uint8_t c = 0; c < voice->sample_channel_count; c++) {
+        if (bytes_per_sample == 2) {
+            uint16_t raw = ((uint16_t*) voice->convert_buffer)[c];
+            samples[c] = voice->sample_signed ? (int16_t) raw : (int16_t) (raw - 0x8000);
+        } else {
+            uint8_t raw = voice->convert_buffer[c];
+            samples[c] = (voice->sample_signed ? (int8_t) raw : (int8_t) (raw - 0x80)) * 256;
+        }
+    }
+    voice->convert_buffer += frame_length;
+    voice->convert_length -= frame_length;
+
+    int16_t* frame = voice->history[voice->history_pos];
+    if (voice->sample_channel_count == self->channel_count) {
+        for (uint8_t c = 0; c < self->channel_count; c++) {
+            frame[c] = samples[c];
+        }
+    } else if (self->channel_count == 1) {
+        frame[0] = (samples[0] + samples[1]) >> 1;
+    } else {
+        frame[0] = samples[0];
+        frame[1] = samples[0];
+    }
+    voice->history_pos = (voice->history_pos + 1) % AUDIOMIXER_HISTORY_LEN;
+    return true;
+}
+
+// Mixes a voice whose sample rate, channel count, sample size or signedness
+// differs from the mixer's, converting a frame at a time. The polyphase filter
+// delays the voice by three frames more than linear interpolation does.
+static void mix_down_converted_voice(audiomixer_mixer_obj_t* self,
+        audiomixer_mixervoice_obj_t* voice, bool voices_active,
+        uint32_t* word_buffer, uint32_t length) {
+    uint8_t channel_count = self->channel_count;
+    uint32_t frames = length * sizeof(uint32_t) / (channel_count * self->bits_per_sample / 8);
+    int16_t* hword_buffer = (int16_t*) word_buffer;
+    int8_t* byte_buffer = (int8_t*) word_buffer;
+    int32_t ramp_step = 0;
+    if (voice->ramp_level != voice->level) {
+        ramp_step = level_ramp_step(voice, frames);
+    }
+
+    // The voice may stop part way through.
+    if (!voices_active) {
+        memset(word_buffer, 0, length * sizeof(uint32_t));
+    }
+
+    for (uint32_t i = 0; i < frames; i++) {
+        while (voice->phase >= (1 << 16)) {
+            if (!read_frame(self, voice)) {
+                return;
+            }
+            voice->phase -= 1 << 16;
+        }
+        uint8_t pos = voice->history_pos;
+        for (uint8_t c = 0; c < channel_count; c++) {
+            int32_t v;
+            if (self->polyphase) {
+                const int16_t* coefficients = polyphase_coefficients[voice->phase >> 11];
+                v = 0;
+                for (uint8_t t = 0; t < AUDIOMIXER_HISTORY_LEN; t++) {
+                    v += coefficients[t] * voice->history[(pos + t) % AUDIOMIXER_HISTORY_LEN][c];
+                }
+                v = saturate16(v >> 14);
+            } else {
+                int32_t x0 = voice->history[(pos + AUDIOMIXER_HISTORY_LEN - 2) % AUDIOMIXER_HISTORY_LEN][c];
+                int32_t x1 = voice->history[(pos + AUDIOMIXER_HISTORY_LEN - 1) % AUDIOMIXER_HISTORY_LEN][c];
+                v = x0 + (((x1 - x0) * (int32_t) (voice->phase >> 1)) >> 15);
+            }
+            v = (v * voice->ramp_level) >> 15;
+            uint32_t out = i * channel_count + c;
+            if (self->bits_per_sample == 16) {
+                hword_buffer[out] = saturate16(hword_buffer[out] + v);
+            } else {
+                byte_buffer[out] = saturate16(byte_buffer[out] * 256 + v) >> 8;
+            }
+        }
+        voice->phase += voice->step;
+        if (voice->ramp_level != voice->level) {
+            advance_level_ramp(voice, ramp_step);
+        }
+    }
+}
+
 audioio_get_buffer_result_t audiomixer_mixer_get_buffer(audiomixer_mixer_obj_t* self,
                                                         bool single_channel,
                                                         uint8_t channel,
@@ -265,7 +433,10 @@ audioio_get_buffer_result_t audiomixer_mixer_get_buffer(audiomixer_mixer_obj_t*
 
         for (int32_t v = 0; v < self->voice_count; v++) {
             audiomixer_mixervoice_obj_t* voice = MP_OBJ_TO_PTR(self->voice[v]);
-            if(voice->sample) {
+            if (voice->sample && voice->convert) {
+                mix_down_converted_voice(self, voice, voices_active, word_buffer, length);
+                voices_active = true;
+            } else if(voice->sample) {
                 mix_down_one_voice(self, voice, voices_active, word_buffer, length);
                 voices_active = true;
             }
@@ -306,6 +477,15 @@ audioio_get_buffer_result_t audiomixer_mixer_get_buffer(audiomixer_mixer_obj_t*
     return GET_BUFFER_MORE_DATA;
 }
 
+void audiomixer_mixer_prefetch(audiomixer_mixer_obj_t* self) {
+    for (int32_t v = 0; v < self->voice_count; v++) {
+        audiomixer_mixervoice_obj_t* voice = MP_OBJ_TO_PTR(self->voice[v]);
+        if (voice->sample) {
+            audiosample_prefetch(voice->sample);
+        }
+    }
+}
+
 void audiomixer_mixer_get_buffer_structure(audiomixer_mixer_obj_t* self, bool single_channel,
                                         bool* single_buffer, bool* samples_signed,
                                         uint32_t* max_buffer_length, uint8_t* spacing) {
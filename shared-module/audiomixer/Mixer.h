@@ -42,6 +42,7 @@ typedef struct {
     bool samples_signed;
     uint8_t channel_count;
     uint32_t sample_rate;
+    bool polyphase;
 
     uint32_t read_count;
     uint32_t left_read_count;
@@ -65,5 +66,6 @@ audioio_get_buffer_result_t audiomixer_mixer_get_buffer(audiomixer_mixer_obj_t*
 void audiomixer_mixer_get_buffer_structure(audiomixer_mixer_obj_t* self, bool single_channel,
                                             bool* single_buffer, bool* samples_signed,
                                             uint32_t* max_buffer_length, uint8_t* spacing);
+void audiomixer_mixer_prefetch(audiomixer_mixer_obj_t* self);
 
 #endif // MICROPY_INCLUDED_SHARED_MODULE_AUDIOMIXER_MIXER_H
@@ -27,6 +27,7 @@
 #include "shared-module/audiomixer/MixerVoice.h"
 
 #include <stdint.h>
+#include <string.h>
 
 #include "py/runtime.h"
 #include "shared-module/audiomixer/__init__.h"
@@ -35,6 +36,7 @@
 void common_hal_audiomixer_mixervoice_construct(audiomixer_mixervoice_obj_t *self) {
     self->sample = NULL;
     self->level = 1 << 15;
+    self->ramp_level = self->level;
 }
 
 void common_hal_audiomixer_mixervoice_set_parent(audiomixer_mixervoice_obj_t* self, audiomixer_mixer_obj_t *parent) {
@@ -50,14 +52,17 @@ void common_hal_audiomixer_mixervoice_set_level(audiomixer_mixervoice_obj_t* sel
 }
 
 void common_hal_audiomixer_mixervoice_play(audiomixer_mixervoice_obj_t* self, mp_obj_t sample, bool loop) {
-    if (audiosample_sample_rate(sample) != self->parent->sample_rate) {
-        mp_raise_ValueError(translate("The sample's sample rate does not match the mixer's"));
+    uint32_t sample_rate = audiosample_sample_rate(sample);
+    uint8_t channel_count = audiosample_channel_count(sample);
+    uint8_t bits_per_sample = audiosample_bits_per_sample(sample);
+    if (sample_rate < 1 || sample_rate / self->parent->sample_rate >= 0x10000) {
+        mp_raise_ValueError(translate("sampling rate out of range"));
     }
-    if (audiosample_channel_count(sample) != self->parent->channel_count) {
-        mp_raise_ValueError(translate("The sample's channel count does not match the mixer's"));
+    if (channel_count < 1 || channel_count > 2) {
+        mp_raise_ValueError(translate("Invalid channel count"));
     }
-    if (audiosample_bits_per_sample(sample) != self->parent->bits_per_sample) {
-        mp_raise_ValueError(translate("The sample's bits_per_sample does not match the mixer's"));
+    if (bits_per_sample != 8 && bits_per_sample != 16) {
+        mp_raise_ValueError(translate("bits_per_sample must be 8 or 16"));
     }
     bool single_buffer;
     bool samples_signed;
@@ -65,17 +70,32 @@ void common_hal_audiomixer_mixervoice_play(audiomixer_mixervoice_obj_t* self, mp
     uint8_t spacing;
     audiosample_get_buffer_structure(sample, false, &single_buffer, &samples_signed,
                                      &max_buffer_length, &spacing);
-    if (samples_signed != self->parent->samples_signed) {
-        mp_raise_ValueError(translate("The sample's signedness does not match the mixer's"));
-    }
-    self->sample = sample;
+    // Stop the voice while it is set up, in case the mixer is playing.
+    self->sample = NULL;
+    self->convert = sample_rate != self->parent->sample_rate ||
+        channel_count != self->parent->channel_count ||
+        bits_per_sample != self->parent->bits_per_sample ||
+        samples_signed != self->parent->samples_signed;
+    self->sample_channel_count = channel_count;
+    self->sample_bits_per_sample = bits_per_sample;
+    self->sample_signed = samples_signed;
+    self->ramp_level = self->level;
+    self->step = ((uint64_t) sample_rate << 16) / self->parent->sample_rate;
+    // Start with an empty history and the first two frames still to read so
+    // that the first output frame lines up with the first sample frame.
+    self->phase = 2 << 16;
+    self->history_pos = 0;
+    memset(self->history, 0, sizeof(self->history));
     self->loop = loop;
 
     audiosample_reset_buffer(sample, false, 0);
     audioio_get_buffer_result_t result = audiosample_get_buffer(sample, false, 0, (uint8_t**) &self->remaining_buffer, &self->buffer_length);
+    self->convert_buffer = (uint8_t*) self->remaining_buffer;
+    self->convert_length = self->buffer_length;
     // Track length in terms of words.
     self->buffer_length /= sizeof(uint32_t);
     self->more_data = result == GET_BUFFER_MORE_DATA;
+    self->sample = sample;
 }
 
 bool common_hal_audiomixer_mixervoice_get_playing(audiomixer_mixervoice_obj_t* self) {
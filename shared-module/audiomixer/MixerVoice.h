@@ -31,6 +31,11 @@
 #include "shared-module/audiomixer/__init__.h"
 #include "shared-module/audiomixer/Mixer.h"
 
+// Number of sample frames kept for resampling.
+#define AUDIOMIXER_HISTORY_LEN (8)
+// Number of words mixed at each step of a level ramp.
+#define AUDIOMIXER_RAMP_WORDS (8)
+
 typedef struct {
 	mp_obj_base_t base;
 	audiomixer_mixer_obj_t *parent;
@@ -40,6 +45,22 @@ typedef struct {
     uint32_t* remaining_buffer;
     uint32_t buffer_length;
     uint16_t level;
+    // The level being applied. Changes to level ramp over one mixer buffer.
+    uint16_t ramp_level;
+
+    // Samples whose format differs from the mixer's are converted a frame at
+    // a time, from a buffer tracked in bytes rather than words.
+    bool convert;
+    uint8_t sample_channel_count;
+    uint8_t sample_bits_per_sample;
+    bool sample_signed;
+    uint8_t* convert_buffer;
+    uint32_t convert_length;
+    uint32_t step; // sample frames per mixer frame, 16.16 fixed point
+    uint32_t phase; // position after the second newest frame, 16.16 fixed point
+    uint8_t history_pos; // index of the oldest frame
+    // The last frames of the sample, in the mixer's channels.
+    int16_t history[AUDIOMIXER_HISTORY_LEN][2];
 } audiomixer_mixervoice_obj_t;
 
 
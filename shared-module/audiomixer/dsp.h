@@ -0,0 +1,107 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018 Scott Shawcroft for Adafruit Industries
+ *               2018 DeanM for Adafruit Industries
+ *               2019 Michael Schroeder
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SHARED_MODULE_AUDIOMIXER_DSP_H
+#define MICROPY_INCLUDED_SHARED_MODULE_AUDIOMIXER_DSP_H
+
+#include <stdint.h>
+
+// Operations on a pair of signed 16 bit samples packed into a word. These use
+// the Cortex-M4 DSP instructions so include this after the port's headers.
+// Other builds, such as the unix coverage build that tests the mixer, get
+// plain C versions that give the same results.
+
+#if defined(__ARM_FEATURE_DSP)
+
+__attribute__((always_inline))
+static inline uint32_t add16signed(uint32_t a, uint32_t b) {
+    return __QADD16(a, b);
+}
+
+__attribute__((always_inline))
+static inline uint32_t mult16signed(uint32_t val, int32_t mul) {
+    mul <<= 16;
+    int32_t hi, lo;
+    enum { bits = 16 }; // saturate to 16 bits
+    enum { shift = 15 }; // shift is done automatically
+    asm volatile("smulwb %0, %1, %2" : "=r" (lo) : "r" (mul), "r" (val));
+    asm volatile("smulwt %0, %1, %2" : "=r" (hi) : "r" (mul), "r" (val));
+    asm volatile("ssat %0, %1, %2, asr %3" : "=r" (lo) : "I" (bits), "r" (lo), "I" (shift));
+    asm volatile("ssat %0, %1, %2, asr %3" : "=r" (hi) : "I" (bits), "r" (hi), "I" (shift));
+    asm volatile("pkhbt %0, %1, %2, lsl #16" : "=r" (val) : "r" (lo), "r" (hi)); // pack
+    return val;
+}
+
+#else
+
+static inline int32_t dsp_saturate16(int32_t val) {
+    if (val > INT16_MAX) {
+        return INT16_MAX;
+    } else if (val < INT16_MIN) {
+        return INT16_MIN;
+    }
+    return val;
+}
+
+static inline uint32_t dsp_pack16(int32_t lo, int32_t hi) {
+    return ((uint32_t) hi << 16) | ((uint32_t) lo & 0xffff);
+}
+
+static inline uint32_t __QADD16(uint32_t a, uint32_t b) {
+    return dsp_pack16(dsp_saturate16((int16_t) a + (int16_t) b),
+                      dsp_saturate16((int16_t) (a >> 16) + (int16_t) (b >> 16)));
+}
+
+static inline uint32_t __UADD16(uint32_t a, uint32_t b) {
+    return ((a & 0xffff0000) + (b & 0xffff0000)) | ((a + b) & 0xffff);
+}
+
+static inline uint32_t __UADD8(uint32_t a, uint32_t b) {
+    return (((a & 0x7f7f7f7f) + (b & 0x7f7f7f7f)) ^ ((a ^ b) & 0x80808080));
+}
+
+static inline int64_t __SMLALD(uint32_t a, uint32_t b, int64_t acc) {
+    return acc + (int32_t) (int16_t) a * (int16_t) b +
+           (int32_t) (int16_t) (a >> 16) * (int16_t) (b >> 16);
+}
+
+static inline uint32_t add16signed(uint32_t a, uint32_t b) {
+    return __QADD16(a, b);
+}
+
+static inline uint32_t mult16signed(uint32_t val, int32_t mul) {
+    // Like smulwb and smulwt, keep the top 32 bits of the 48 bit product.
+    int32_t m = (int32_t) ((uint32_t) mul << 16);
+    int32_t lo = ((int64_t) m * (int16_t) val) >> 16;
+    int32_t hi = ((int64_t) m * (int16_t) (val >> 16)) >> 16;
+    return dsp_pack16(dsp_saturate16(lo >> 15), dsp_saturate16(hi >> 15));
+}
+
+#endif
+
+#endif // MICROPY_INCLUDED_SHARED_MODULE_AUDIOMIXER_DSP_H
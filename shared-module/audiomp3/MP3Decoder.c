@@ -40,6 +40,40 @@
 
 #define MAX_BUFFER_LEN (MAX_NSAMP * MAX_NGRAN * MAX_NCHAN * sizeof(int16_t))
 
+/** Move the unconsumed data to the start of the input buffer and fill the
+ * rest from the file.
+ *
+ * Returns false if f_read fails.
+ *
+ * Sets self->eof if the read fails or returns 0 bytes
+ */
+STATIC bool mp3file_fill_inbuf(audiomp3_mp3file_obj_t* self) {
+    // Move the unconsumed portion of the buffer to the start
+    uint8_t *end_of_buffer = self->inbuf + self->inbuf_length;
+    uint8_t *new_end_of_data = self->inbuf + self->inbuf_length - self->inbuf_offset;
+    memmove(self->inbuf, self->inbuf + self->inbuf_offset,
+        self->inbuf_length - self->inbuf_offset);
+    self->inbuf_offset = 0;
+
+    UINT to_read = end_of_buffer - new_end_of_data;
+    UINT bytes_read = 0;
+    memset(new_end_of_data, 0, to_read);
+    if (f_read(&self->file->fp, new_end_of_data, to_read, &bytes_read) != FR_OK) {
+        self->eof = true;
+        return false;
+    }
+
+    if (bytes_read == 0) {
+        self->eof = true;
+    }
+
+    if (to_read != bytes_read) {
+        new_end_of_data += bytes_read;
+        memset(new_end_of_data, 0, end_of_buffer - new_end_of_data);
+    }
+    return true;
+}
+
 /** Fill the input buffer if it is less than half full.
  *
  * Returns true if the input buffer contains any useful data,
@@ -55,32 +89,8 @@ STATIC bool mp3file_update_inbuf(audiomp3_mp3file_obj_t* self) {
     if (self->inbuf_offset < self->inbuf_length/2) return true;
 
     // If we didn't previously reach the end of file, we can try reading now
-    if (!self->eof) {
-
-        // Move the unconsumed portion of the buffer to the start
-        uint8_t *end_of_buffer = self->inbuf + self->inbuf_length;
-        uint8_t *new_end_of_data = self->inbuf + self->inbuf_length - self->inbuf_offset;
-        memmove(self->inbuf, self->inbuf + self->inbuf_offset,
-            self->inbuf_length - self->inbuf_offset);
-        self->inbuf_offset = 0;
-
-        UINT to_read = end_of_buffer - new_end_of_data;
-        UINT bytes_read = 0;
-        memset(new_end_of_data, 0, to_read);
-        if (f_read(&self->file->fp, new_end_of_data, to_read, &bytes_read) != FR_OK) {
-            self->eof = true;
-            mp_raise_OSError(MP_EIO);
-        }
-
-        if (bytes_read == 0) {
-            self->eof = true;
-        }
-
-        if (to_read != bytes_read) {
-            new_end_of_data += bytes_read;
-            memset(new_end_of_data, 0, end_of_buffer - new_end_of_data);
-        }
-
+    if (!self->eof && !mp3file_fill_inbuf(self)) {
+        mp_raise_OSError(MP_EIO);
     }
 
     // Return true iff there are at least some useful bytes in the buffer
@@ -157,7 +167,8 @@ STATIC bool mp3file_get_next_frame_info(audiomp3_mp3file_obj_t* self, MP3FrameIn
 void common_hal_audiomp3_mp3file_construct(audiomp3_mp3file_obj_t* self,
                                            pyb_file_obj_t* file,
                                            uint8_t *buffer,
-                                           size_t buffer_size) {
+                                           size_t buffer_size,
+                                           size_t input_buffer_size) {
     // XXX Adafruit_MP3 uses a 2kB input buffer and two 4kB output buffers.
     // for a whopping total of 10kB buffers (+mp3 decoder state and frame buffer)
     // At 44kHz, that's 23ms of output audio data.
@@ -168,7 +179,7 @@ void common_hal_audiomp3_mp3file_construct(audiomp3_mp3file_obj_t* self,
     // than the two 4kB output buffers, except that the alignment allows to
     // never allocate that extra frame buffer.
 
-    self->inbuf_length = 2048;
+    self->inbuf_length = input_buffer_size;
     self->inbuf_offset = self->inbuf_length;
     self->inbuf = m_malloc(self->inbuf_length, false);
     if (self->inbuf == NULL) {
@@ -214,6 +225,7 @@ void common_hal_audiomp3_mp3file_set_file(audiomp3_mp3file_obj_t* self, pyb_file
     self->inbuf_offset = self->inbuf_length;
     self->eof = 0;
     self->other_channel = -1;
+    self->underruns = 0;
     mp3file_update_inbuf(self);
     mp3file_find_sync_word(self);
     // It **SHOULD** not be necessary to do this; the buffer should be filled
@@ -265,6 +277,10 @@ uint8_t common_hal_audiomp3_mp3file_get_channel_count(audiomp3_mp3file_obj_t* se
     return self->channel_count;
 }
 
+uint32_t common_hal_audiomp3_mp3file_get_underruns(audiomp3_mp3file_obj_t* self) {
+    return self->underruns;
+}
+
 bool audiomp3_mp3file_samples_signed(audiomp3_mp3file_obj_t* self) {
     return true;
 }
@@ -286,6 +302,15 @@ void audiomp3_mp3file_reset_buffer(audiomp3_mp3file_obj_t* self,
     mp3file_find_sync_word(self);
 }
 
+void audiomp3_mp3file_prefetch(audiomp3_mp3file_obj_t* self) {
+    // Top up the input buffer once a sector's worth of it has been decoded so
+    // that get_buffer rarely needs to read from the file itself.
+    if (self->inbuf == NULL || self->eof || self->inbuf_offset < 512) {
+        return;
+    }
+    mp3file_fill_inbuf(self);
+}
+
 audioio_get_buffer_result_t audiomp3_mp3file_get_buffer(audiomp3_mp3file_obj_t* self,
                                                         bool single_channel,
                                                         uint8_t channel,
@@ -313,6 +338,10 @@ audioio_get_buffer_result_t audiomp3_mp3file_get_buffer(audiomp3_mp3file_obj_t*
     int16_t *buffer = (int16_t *)(void *)self->buffers[self->buffer_index];
     *bufptr = (uint8_t*)buffer;
 
+    // The background read ahead didn't keep up so the file is read below.
+    if (!self->eof && self->inbuf_offset >= self->inbuf_length / 2) {
+        self->underruns += 1;
+    }
     mp3file_skip_id3v2(self);
     if (!mp3file_find_sync_word(self)) {
         return self->eof ? GET_BUFFER_DONE : GET_BUFFER_ERROR;
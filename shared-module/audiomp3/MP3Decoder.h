@@ -52,6 +52,8 @@ typedef struct {
 
     int8_t other_channel;
     int8_t other_buffer_index;
+
+    uint32_t underruns;
 } audiomp3_mp3file_obj_t;
 
 // These are not available from Python because it may be called in an interrupt.
@@ -66,6 +68,7 @@ audioio_get_buffer_result_t audiomp3_mp3file_get_buffer(audiomp3_mp3file_obj_t*
 void audiomp3_mp3file_get_buffer_structure(audiomp3_mp3file_obj_t* self, bool single_channel,
                                            bool* single_buffer, bool* samples_signed,
                                            uint32_t* max_buffer_length, uint8_t* spacing);
+void audiomp3_mp3file_prefetch(audiomp3_mp3file_obj_t* self);
 
 float audiomp3_mp3file_get_rms_level(audiomp3_mp3file_obj_t* self);
 
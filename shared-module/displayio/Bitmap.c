@@ -30,6 +30,46 @@
 
 #include "py/runtime.h"
 
+// Expands the dirty area of every band that the given region touches. Band b covers rows
+// ceil(b * height / N) up to ceil((b + 1) * height / N).
+static void _mark_dirty(displayio_bitmap_t *self, int16_t x1, int16_t y1, int16_t x2, int16_t y2) {
+    if (self->height == 0) {
+        return;
+    }
+    uint32_t first_band = y1 * DISPLAYIO_BITMAP_DIRTY_BANDS / self->height;
+    uint32_t last_band = (y2 - 1) * DISPLAYIO_BITMAP_DIRTY_BANDS / self->height;
+    for (uint32_t b = first_band; b <= last_band; b++) {
+        int16_t band_y1 = (b * self->height + DISPLAYIO_BITMAP_DIRTY_BANDS - 1) / DISPLAYIO_BITMAP_DIRTY_BANDS;
+        int16_t band_y2 = ((b + 1) * self->height + DISPLAYIO_BITMAP_DIRTY_BANDS - 1) / DISPLAYIO_BITMAP_DIRTY_BANDS;
+        if (band_y1 < y1) {
+            band_y1 = y1;
+        }
+        if (band_y2 > y2) {
+            band_y2 = y2;
+        }
+        displayio_area_t* band = &self->dirty_bands[b];
+        if (band->x1 == band->x2) {
+            band->x1 = x1;
+            band->x2 = x2;
+            band->y1 = band_y1;
+            band->y2 = band_y2;
+            continue;
+        }
+        if (x1 < band->x1) {
+            band->x1 = x1;
+        }
+        if (x2 > band->x2) {
+            band->x2 = x2;
+        }
+        if (band_y1 < band->y1) {
+            band->y1 = band_y1;
+        }
+        if (band_y2 > band->y2) {
+            band->y2 = band_y2;
+        }
+    }
+}
+
 void common_hal_displayio_bitmap_construct(displayio_bitmap_t *self, uint32_t width,
     uint32_t height, uint32_t bits_per_value) {
     uint32_t row_width = width * bits_per_value;
@@ -64,10 +104,11 @@ void common_hal_displayio_bitmap_construct(displayio_bitmap_t *self, uint32_t wi
     self->x_mask = (1 << self->x_shift) - 1; // Used as a modulus on the x value
     self->bitmask = (1 << bits_per_value) - 1;
 
-    self->dirty_area.x1 = 0;
-    self->dirty_area.x2 = width;
-    self->dirty_area.y1 = 0;
-    self->dirty_area.y2 = height;
+    for (uint8_t i = 0; i < DISPLAYIO_BITMAP_DIRTY_BANDS; i++) {
+        self->dirty_bands[i].x1 = 0;
+        self->dirty_bands[i].x2 = 0;
+    }
+    _mark_dirty(self, 0, 0, width, height);
 }
 
 uint16_t common_hal_displayio_bitmap_get_height(displayio_bitmap_t *self) {
@@ -82,10 +123,8 @@ uint32_t common_hal_displayio_bitmap_get_bits_per_value(displayio_bitmap_t *self
     return self->bits_per_value;
 }
 
-uint32_t common_hal_displayio_bitmap_get_pixel(displayio_bitmap_t *self, int16_t x, int16_t y) {
-    if (x >= self->width || x < 0 || y >= self->height || y < 0) {
-        return 0;
-    }
+// Reads a value without bounds checking.
+static uint32_t _read_pixel(const displayio_bitmap_t *self, int16_t x, int16_t y) {
     int32_t row_start = y * self->stride;
     uint32_t bytes_per_value = self->bits_per_value / 8;
     if (bytes_per_value < 1) {
@@ -105,38 +144,16 @@ uint32_t common_hal_displayio_bitmap_get_pixel(displayio_bitmap_t *self, int16_t
     return 0;
 }
 
-void common_hal_displayio_bitmap_set_pixel(displayio_bitmap_t *self, int16_t x, int16_t y, uint32_t value) {
-    if (self->read_only) {
-        mp_raise_RuntimeError(translate("Read-only object"));
-    }
-    // Update the dirty area.
-    if (self->dirty_area.x1 == self->dirty_area.x2) {
-        self->dirty_area.x1 = x;
-        self->dirty_area.x2 = x + 1;
-        self->dirty_area.y1 = y;
-        self->dirty_area.y2 = y + 1;
-    } else {
-        if (x < self->dirty_area.x1) {
-            self->dirty_area.x1 = x;
-        } else if (x >= self->dirty_area.x2) {
-            self->dirty_area.x2 = x + 1;
-        }
-        if (y < self->dirty_area.y1) {
-            self->dirty_area.y1 = y;
-        } else if (y >= self->dirty_area.y2) {
-            self->dirty_area.y2 = y + 1;
-        }
-    }
-
-    // Update our data
+// Writes a value without bounds checking or dirty tracking.
+static void _write_pixel(displayio_bitmap_t *self, int16_t x, int16_t y, uint32_t value) {
     int32_t row_start = y * self->stride;
     uint32_t bytes_per_value = self->bits_per_value / 8;
     if (bytes_per_value < 1) {
         uint32_t bit_position = (sizeof(size_t) * 8 - ((x & self->x_mask) + 1) * self->bits_per_value);
         uint32_t index = row_start + (x >> self->x_shift);
-        uint32_t word = self->data[index];
-        word &= ~(self->bitmask << bit_position);
-        word |= (value & self->bitmask) << bit_position;
+        size_t word = self->data[index];
+        word &= ~((size_t) self->bitmask << bit_position);
+        word |= (size_t) (value & self->bitmask) << bit_position;
         self->data[index] = word;
     } else {
         size_t* row = self->data + row_start;
@@ -150,17 +167,154 @@ void common_hal_displayio_bitmap_set_pixel(displayio_bitmap_t *self, int16_t x,
     }
 }
 
+uint32_t common_hal_displayio_bitmap_get_pixel(displayio_bitmap_t *self, int16_t x, int16_t y) {
+    if (x >= self->width || x < 0 || y >= self->height || y < 0) {
+        return 0;
+    }
+    return _read_pixel(self, x, y);
+}
+
+void common_hal_displayio_bitmap_set_pixel(displayio_bitmap_t *self, int16_t x, int16_t y, uint32_t value) {
+    if (self->read_only) {
+        mp_raise_RuntimeError(translate("Read-only object"));
+    }
+    // Update the dirty area.
+    _mark_dirty(self, x, y, x + 1, y + 1);
+
+    // Update our data
+    _write_pixel(self, x, y, value);
+}
+
 displayio_area_t* displayio_bitmap_get_refresh_areas(displayio_bitmap_t *self, displayio_area_t* tail) {
-    if (self->dirty_area.x1 == self->dirty_area.x2) {
-        return tail;
+    // Fold bands that continue the one above with the same columns, such as after a fill, so
+    // that large changes still come out as a single area. The folded band is emptied so calling
+    // this again before the refresh finishes returns the same areas.
+    displayio_area_t* previous = NULL;
+    for (uint8_t i = 0; i < DISPLAYIO_BITMAP_DIRTY_BANDS; i++) {
+        displayio_area_t* band = &self->dirty_bands[i];
+        if (band->x1 == band->x2) {
+            continue;
+        }
+        if (previous != NULL && previous->y2 == band->y1 &&
+            previous->x1 == band->x1 && previous->x2 == band->x2) {
+            previous->y2 = band->y2;
+            band->x2 = band->x1;
+            continue;
+        }
+        previous = band;
+    }
+    // Link back to front so the areas come out top to bottom.
+    for (int8_t i = DISPLAYIO_BITMAP_DIRTY_BANDS - 1; i >= 0; i--) {
+        displayio_area_t* band = &self->dirty_bands[i];
+        if (band->x1 == band->x2) {
+            continue;
+        }
+        band->next = tail;
+        tail = band;
     }
-    self->dirty_area.next = tail;
-    return &self->dirty_area;
+    return tail;
 }
 
 void displayio_bitmap_finish_refresh(displayio_bitmap_t *self) {
-    self->dirty_area.x1 = 0;
-    self->dirty_area.x2 = 0;
+    for (uint8_t i = 0; i < DISPLAYIO_BITMAP_DIRTY_BANDS; i++) {
+        self->dirty_bands[i].x1 = 0;
+        self->dirty_bands[i].x2 = 0;
+    }
+}
+
+// Returns a word with every value in it set to value.
+static size_t _packed_word(const displayio_bitmap_t *self, uint32_t value) {
+    uint8_t bits = self->bits_per_value;
+    size_t value_mask = bits < 32 ? ((1u << bits) - 1) : 0xffffffff;
+    size_t word = 0;
+    for (uint8_t i = 0; i < sizeof(size_t) * 8 / bits; i++) {
+        word |= (size_t) (value & value_mask) << (sizeof(size_t) * 8 - ((i + 1) * bits));
+    }
+    return word;
+}
+
+// Returns the bits of a word that hold the values from start up to, but not including, end.
+static size_t _word_mask(const displayio_bitmap_t *self, uint32_t start, uint32_t end) {
+    size_t mask = ~((size_t) 0) >> (start * self->bits_per_value);
+    uint32_t end_bit = end * self->bits_per_value;
+    if (end_bit < sizeof(size_t) * 8) {
+        mask &= ~(~((size_t) 0) >> end_bit);
+    }
+    return mask;
+}
+
+static inline size_t _merge_word(size_t dest, size_t source, size_t mask) {
+    return (dest & ~mask) | (source & mask);
+}
+
+// Sets x1 up to, but not including, x2 in row y to the values packed into word.
+static void _fill_row(displayio_bitmap_t *self, int16_t y, int16_t x1, int16_t x2, size_t word) {
+    size_t* row = self->data + y * self->stride;
+    uint32_t bytes_per_value = self->bits_per_value / 8;
+    if (bytes_per_value == 1) {
+        memset(((uint8_t*) row) + x1, word, x2 - x1);
+        return;
+    } else if (bytes_per_value == 2) {
+        uint16_t* values = (uint16_t*) row;
+        for (int16_t x = x1; x < x2; x++) {
+            values[x] = word;
+        }
+        return;
+    } else if (bytes_per_value == 4) {
+        uint32_t* values = (uint32_t*) row;
+        for (int16_t x = x1; x < x2; x++) {
+            values[x] = word;
+        }
+        return;
+    }
+
+    uint32_t values_per_word = 1 << self->x_shift;
+    uint32_t first = x1 >> self->x_shift;
+    uint32_t last = (x2 - 1) >> self->x_shift;
+    uint32_t end = ((x2 - 1) & self->x_mask) + 1;
+    if (first == last) {
+        row[first] = _merge_word(row[first], word, _word_mask(self, x1 & self->x_mask, end));
+        return;
+    }
+    row[first] = _merge_word(row[first], word, _word_mask(self, x1 & self->x_mask, values_per_word));
+    for (uint32_t i = first + 1; i < last; i++) {
+        row[i] = word;
+    }
+    row[last] = _merge_word(row[last], word, _word_mask(self, 0, end));
+}
+
+// Copies width values from row y1 of source, starting at x1, to row y of self, starting at x.
+// Both bitmaps must have the same depth and, when values are packed, the same position within a
+// word. Overlapping copies within one bitmap are fine.
+static void _copy_row(displayio_bitmap_t *self, int16_t x, int16_t y, displayio_bitmap_t *source,
+        int16_t x1, int16_t y1, int16_t width) {
+    size_t* dest_row = self->data + y * self->stride;
+    size_t* source_row = source->data + y1 * source->stride;
+    uint32_t bytes_per_value = self->bits_per_value / 8;
+    if (bytes_per_value > 0) {
+        memmove(((uint8_t*) dest_row) + x * bytes_per_value,
+                ((uint8_t*) source_row) + x1 * bytes_per_value,
+                width * bytes_per_value);
+        return;
+    }
+
+    uint32_t values_per_word = 1 << self->x_shift;
+    uint32_t first = x >> self->x_shift;
+    uint32_t last = (x + width - 1) >> self->x_shift;
+    size_t* source_words = source_row + (x1 >> self->x_shift) - first;
+    uint32_t end = ((x + width - 1) & self->x_mask) + 1;
+    if (first == last) {
+        dest_row[first] = _merge_word(dest_row[first], source_words[first],
+            _word_mask(self, x & self->x_mask, end));
+        return;
+    }
+    // Read the partial words before the middle is moved in case the copy overlaps them.
+    size_t first_word = _merge_word(dest_row[first], source_words[first],
+        _word_mask(self, x & self->x_mask, values_per_word));
+    size_t last_word = _merge_word(dest_row[last], source_words[last], _word_mask(self, 0, end));
+    memmove(dest_row + first + 1, source_words + first + 1, (last - first - 1) * sizeof(size_t));
+    dest_row[first] = first_word;
+    dest_row[last] = last_word;
 }
 
 void common_hal_displayio_bitmap_fill(displayio_bitmap_t *self, uint32_t value) {
@@ -168,18 +322,70 @@ void common_hal_displayio_bitmap_fill(displayio_bitmap_t *self, uint32_t value)
         mp_raise_RuntimeError(translate("Read-only object"));
     }
     // Update the dirty area.
-    self->dirty_area.x1 = 0;
-    self->dirty_area.x2 = self->width;
-    self->dirty_area.y1 = 0;
-    self->dirty_area.y2 = self->height;
+    _mark_dirty(self, 0, 0, self->width, self->height);
 
     // build the packed word
-    uint32_t word = 0;
-    for (uint8_t i=0; i<32 / self->bits_per_value; i++) {
-        word |= (value & self->bitmask) << (32 - ((i+1)*self->bits_per_value));
-    }
+    size_t word = _packed_word(self, value);
     // copy it in
     for (uint32_t i=0; i<self->stride * self->height; i++) {
         self->data[i] = word;
     }
 }
+
+void common_hal_displayio_bitmap_fill_region(displayio_bitmap_t *self, int16_t x1, int16_t y1,
+        int16_t x2, int16_t y2, uint32_t value) {
+    if (self->read_only) {
+        mp_raise_RuntimeError(translate("Read-only object"));
+    }
+    if (x1 >= x2 || y1 >= y2) {
+        return;
+    }
+    _mark_dirty(self, x1, y1, x2, y2);
+
+    size_t word = _packed_word(self, value);
+    for (int16_t y = y1; y < y2; y++) {
+        _fill_row(self, y, x1, x2, word);
+    }
+}
+
+void common_hal_displayio_bitmap_blit(displayio_bitmap_t *self, int16_t x, int16_t y,
+        displayio_bitmap_t *source, int16_t x1, int16_t y1, int16_t x2, int16_t y2,
+        uint32_t skip_index, bool skip_index_none) {
+    if (self->read_only) {
+        mp_raise_RuntimeError(translate("Read-only object"));
+    }
+    // Clip the source region to what fits in the target.
+    if (x2 - x1 > self->width - x) {
+        x2 = x1 + self->width - x;
+    }
+    if (y2 - y1 > self->height - y) {
+        y2 = y1 + self->height - y;
+    }
+    int16_t width = x2 - x1;
+    int16_t height = y2 - y1;
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+    _mark_dirty(self, x, y, x + width, y + height);
+
+    // Go bottom up and right to left when copying within a bitmap towards the end so that values
+    // are read before they are overwritten.
+    bool reverse_rows = source == self && y > y1;
+    bool reverse_columns = source == self && y == y1 && x > x1;
+    bool copy_words = skip_index_none && self->bits_per_value == source->bits_per_value &&
+        (self->bits_per_value >= 8 || (x & self->x_mask) == (x1 & self->x_mask));
+    for (int16_t row = 0; row < height; row++) {
+        int16_t i = reverse_rows ? height - row - 1 : row;
+        if (copy_words) {
+            _copy_row(self, x, y + i, source, x1, y1 + i, width);
+            continue;
+        }
+        for (int16_t column = 0; column < width; column++) {
+            int16_t j = reverse_columns ? width - column - 1 : column;
+            uint32_t value = _read_pixel(source, x1 + j, y1 + i);
+            if (skip_index_none || value != skip_index) {
+                _write_pixel(self, x + j, y + i, value);
+            }
+        }
+    }
+}
@@ -33,6 +33,10 @@
 #include "py/obj.h"
 #include "shared-module/displayio/area.h"
 
+// Changes are tracked per horizontal band of rows so that sparse updates, such as points plotted
+// far apart, refresh a few small areas instead of one bounding box.
+#define DISPLAYIO_BITMAP_DIRTY_BANDS (4)
+
 typedef struct {
     mp_obj_base_t base;
     uint16_t width;
@@ -42,7 +46,7 @@ typedef struct {
     uint8_t bits_per_value;
     uint8_t x_shift;
     size_t x_mask;
-    displayio_area_t dirty_area;
+    displayio_area_t dirty_bands[DISPLAYIO_BITMAP_DIRTY_BANDS];
     uint16_t bitmask;
     bool read_only;
 } displayio_bitmap_t;
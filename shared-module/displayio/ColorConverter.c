@@ -185,6 +185,12 @@ void displayio_colorconverter_convert(displayio_colorconverter_t *self, const _d
 }
 
 
+// Only colorspaces that convert can't handle produce transparent pixels. This must match
+// displayio_colorconverter_convert.
+bool displayio_colorconverter_is_opaque(displayio_colorconverter_t *self, const _displayio_colorspace_t* colorspace) {
+    return colorspace->depth == 16 || colorspace->tricolor ||
+        (colorspace->grayscale && colorspace->depth <= 8);
+}
 
 // Currently no refresh logic is needed for a ColorConverter.
 bool displayio_colorconverter_needs_refresh(displayio_colorconverter_t *self) {
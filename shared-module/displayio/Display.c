@@ -211,6 +211,19 @@ bool common_hal_displayio_display_set_brightness(displayio_display_obj_t* self,
     return ok;
 }
 
+void common_hal_displayio_display_get_refresh_timing(displayio_display_obj_t* self, uint32_t* render_us, uint32_t* transfer_us) {
+    *render_us = self->core.render_us;
+    *transfer_us = self->core.transfer_us;
+}
+
+uint32_t common_hal_displayio_display_get_refresh_area_overhead(displayio_display_obj_t* self) {
+    return self->core.refresh_area_overhead;
+}
+
+void common_hal_displayio_display_set_refresh_area_overhead(displayio_display_obj_t* self, uint32_t overhead) {
+    self->core.refresh_area_overhead = overhead;
+}
+
 mp_obj_t common_hal_displayio_display_get_bus(displayio_display_obj_t* self) {
     return self->core.bus;
 }
@@ -295,10 +308,13 @@ STATIC bool _refresh_area(displayio_display_obj_t* self, const displayio_area_t*
             subrectangle_size_bytes = displayio_area_size(&subrectangle) / (8 / self->core.colorspace.depth);
         }
 
+        uint64_t render_start = common_hal_time_monotonic_ns();
         memset(mask, 0, mask_length * sizeof(mask[0]));
         memset(buffer, 0, buffer_size * sizeof(buffer[0]));
 
         displayio_display_core_fill_area(&self->core, &subrectangle, mask, buffer);
+        uint64_t transfer_start = common_hal_time_monotonic_ns();
+        self->core.render_us += (transfer_start - render_start) / 1000;
 
         // Can't acquire display bus; skip the rest of the data.
         if (!displayio_display_core_bus_free(&self->core)) {
@@ -308,6 +324,7 @@ STATIC bool _refresh_area(displayio_display_obj_t* self, const displayio_area_t*
         displayio_display_core_begin_transaction(&self->core);
         _send_pixels(self, (uint8_t*) buffer, subrectangle_size_bytes);
         displayio_display_core_end_transaction(&self->core);
+        self->core.transfer_us += (common_hal_time_monotonic_ns() - transfer_start) / 1000;
 
         // TODO(tannewt): Make refresh displays faster so we don't starve other
         // background tasks.
@@ -322,7 +339,8 @@ STATIC void _refresh_display(displayio_display_obj_t* self) {
         return;
     }
     displayio_display_core_start_refresh(&self->core);
-    const displayio_area_t* current_area = _get_refresh_areas(self);
+    displayio_area_t planned_areas[DISPLAYIO_MAX_REFRESH_AREAS];
+    const displayio_area_t* current_area = displayio_display_core_plan_refresh(&self->core, _get_refresh_areas(self), planned_areas);
     while (current_area != NULL) {
         _refresh_area(self, current_area);
         current_area = current_area->next;
@@ -354,7 +354,15 @@ bool displayio_group_fill_area(displayio_group_t *self, const _displayio_colorsp
         else
 #endif
         if (MP_OBJ_IS_TYPE(layer, &displayio_tilegrid_type)) {
-            if (displayio_tilegrid_fill_area(layer, colorspace, area, mask, buffer)) {
+            bool filled_mask;
+            if (displayio_tilegrid_fill_area(layer, colorspace, area, mask, buffer, &filled_mask)) {
+                full_coverage = true;
+                break;
+            }
+            // Several layers may cover the area between them even though none covers it alone.
+            // Only an opaque layer fills in enough of the mask for that to be worth checking.
+            // Groups check after their own opaque layers.
+            if (filled_mask && displayio_area_mask_covered(area, area, mask)) {
                 full_coverage = true;
                 break;
             }
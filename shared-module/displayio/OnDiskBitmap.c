@@ -114,8 +114,65 @@ void common_hal_displayio_ondiskbitmap_construct(displayio_ondiskbitmap_t *self,
         self->stride = (bit_stride / 8);
     }
 
+    uint32_t data_size = self->stride * self->height;
+    self->cache_size = MIN(DISPLAYIO_ONDISKBITMAP_CACHE_SIZE, data_size);
+    self->cache = m_malloc(self->cache_size, false);
+    self->cache_start = 0;
+    self->cache_length = 0;
 }
 
+// Loads the cache with the data around location, which is in row y. Rows are stored bottom up so
+// the rows below y come before it in the file. Those are loaded along with y because refreshes
+// work top to bottom.
+static bool load_cache(displayio_ondiskbitmap_t *self, uint32_t location, int16_t y) {
+    uint16_t file_row = self->height - y - 1;
+    uint32_t row_end = self->data_offset + (uint32_t) (file_row + 1) * self->stride;
+    uint32_t start;
+    uint32_t length;
+    uint16_t rows = self->cache_size / self->stride;
+    if (rows > 0) {
+        uint16_t first_row = file_row + 1 > rows ? file_row + 1 - rows : 0;
+        start = self->data_offset + (uint32_t) first_row * self->stride;
+        length = row_end - start;
+    } else {
+        // Rows are too long to fit so cache a word-aligned piece of this one.
+        start = location & ~3;
+        length = MIN(self->cache_size, row_end - start);
+    }
+
+    self->cache_length = 0;
+    if (f_lseek(&self->file->fp, start) != FR_OK) {
+        return false;
+    }
+    UINT bytes_read;
+    if (f_read(&self->file->fp, self->cache, length, &bytes_read) != FR_OK) {
+        return false;
+    }
+    self->cache_start = start;
+    self->cache_length = bytes_read;
+    return true;
+}
+
+// Copies the pixel data at location, in row y, out of the cache and loads the cache first when
+// needed. Bytes past the end of a short file are left as zero.
+static bool read_pixel_data(displayio_ondiskbitmap_t *self, uint32_t location, int16_t y,
+        uint8_t bytes_per_pixel, uint32_t* pixel_data) {
+    uint32_t cache_end = self->cache_start + self->cache_length;
+    if (location < self->cache_start || location + bytes_per_pixel > cache_end) {
+        if (!load_cache(self, location, y)) {
+            return false;
+        }
+        cache_end = self->cache_start + self->cache_length;
+        if (location + bytes_per_pixel > cache_end) {
+            if (location < cache_end) {
+                memcpy(pixel_data, self->cache + location - self->cache_start, cache_end - location);
+            }
+            return true;
+        }
+    }
+    memcpy(pixel_data, self->cache + location - self->cache_start, bytes_per_pixel);
+    return true;
+}
 
 uint32_t common_hal_displayio_ondiskbitmap_get_pixel(displayio_ondiskbitmap_t *self,
         int16_t x, int16_t y) {
@@ -131,12 +188,8 @@ uint32_t common_hal_displayio_ondiskbitmap_get_pixel(displayio_ondiskbitmap_t *s
     } else {
         location = self->data_offset + (self->height - y - 1) * self->stride + x / pixels_per_byte;
     }
-    // We don't cache here because the underlying FS caches sectors.
-    f_lseek(&self->file->fp, location);
-    UINT bytes_read;
     uint32_t pixel_data = 0;
-    uint32_t result = f_read(&self->file->fp, &pixel_data, bytes_per_pixel, &bytes_read);
-    if (result == FR_OK) {
+    if (read_pixel_data(self, location, y, bytes_per_pixel, &pixel_data)) {
         uint32_t tmp = 0;
         uint8_t red;
         uint8_t green;
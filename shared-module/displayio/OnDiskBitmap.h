@@ -34,6 +34,10 @@
 
 #include "extmod/vfs_fat.h"
 
+// Largest number of bytes of pixel data kept in memory at once. Whole rows are cached when they
+// fit so a refresh reads several rows with one seek instead of seeking for every pixel.
+#define DISPLAYIO_ONDISKBITMAP_CACHE_SIZE (1024)
+
 typedef struct {
     mp_obj_base_t base;
     uint16_t width;
@@ -47,6 +51,10 @@ typedef struct {
     pyb_file_obj_t* file;
     uint8_t bits_per_pixel;
     uint32_t* palette_data;
+    uint8_t* cache;
+    uint32_t cache_start; // File offset of the first cached byte.
+    uint16_t cache_length; // Number of cached bytes that are valid.
+    uint16_t cache_size;
 } displayio_ondiskbitmap_t;
 
 #endif // MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_ONDISKBITMAP_H
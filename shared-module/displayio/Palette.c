@@ -26,20 +26,40 @@
 
 #include "shared-bindings/displayio/Palette.h"
 
+#include "py/gc.h"
 #include "shared-module/displayio/ColorConverter.h"
 
+static void _invalidate_caches(displayio_palette_t* self) {
+    self->cache_valid = false;
+    for (displayio_palette_cache_t* cache = self->other_caches; cache != NULL; cache = cache->next) {
+        cache->valid = false;
+    }
+}
+
 void common_hal_displayio_palette_construct(displayio_palette_t* self, uint16_t color_count) {
     self->color_count = color_count;
     self->colors = (_displayio_color_t *) m_malloc(color_count * sizeof(_displayio_color_t), false);
+    self->converted_colors = (uint16_t *) m_malloc(color_count * sizeof(uint16_t), false);
+    self->other_caches = NULL;
+    self->transparent_count = 0;
+    self->cache_valid = false;
 }
 
 void common_hal_displayio_palette_make_opaque(displayio_palette_t* self, uint32_t palette_index) {
+    if (self->colors[palette_index].transparent) {
+        self->transparent_count--;
+    }
     self->colors[palette_index].transparent = false;
+    _invalidate_caches(self);
     self->needs_refresh = true;
 }
 
 void common_hal_displayio_palette_make_transparent(displayio_palette_t* self, uint32_t palette_index) {
+    if (!self->colors[palette_index].transparent) {
+        self->transparent_count++;
+    }
     self->colors[palette_index].transparent = true;
+    _invalidate_caches(self);
     self->needs_refresh = true;
 }
 
@@ -58,6 +78,7 @@ void common_hal_displayio_palette_set_color(displayio_palette_t* self, uint32_t
     uint8_t chroma = displayio_colorconverter_compute_chroma(color);
     self->colors[palette_index].chroma = chroma;
     self->colors[palette_index].hue = displayio_colorconverter_compute_hue(color);
+    _invalidate_caches(self);
     self->needs_refresh = true;
 }
 
@@ -65,35 +86,82 @@ uint32_t common_hal_displayio_palette_get_color(displayio_palette_t* self, uint3
     return self->colors[palette_index].rgb888;
 }
 
-bool displayio_palette_get_color(displayio_palette_t *self, const _displayio_colorspace_t* colorspace, uint32_t palette_index, uint32_t* color) {
-    if (palette_index > self->color_count || self->colors[palette_index].transparent) {
-        return false; // returns opaque
-    }
-
+static uint16_t _convert_color(const _displayio_color_t* color, const _displayio_colorspace_t* colorspace) {
     if (colorspace->tricolor) {
-        uint8_t luma = self->colors[palette_index].luma;
-        *color = luma >> (8 - colorspace->depth);
+        uint32_t converted = color->luma >> (8 - colorspace->depth);
         // Chroma 0 means the color is a gray and has no hue so never color based on it.
-        if (self->colors[palette_index].chroma  <= 16) {
+        if (color->chroma <= 16) {
             if (!colorspace->grayscale) {
-                *color = 0;
+                converted = 0;
             }
-            return true;
+            return converted;
         }
-        uint8_t pixel_hue = self->colors[palette_index].hue;
-        displayio_colorconverter_compute_tricolor(colorspace, pixel_hue, luma, color);
+        displayio_colorconverter_compute_tricolor(colorspace, color->hue, color->luma, &converted);
+        return converted;
     } else if (colorspace->grayscale) {
-        *color = self->colors[palette_index].luma >> (8 - colorspace->depth);
-    } else {
-        uint16_t packed = self->colors[palette_index].rgb565;
-        if (colorspace->reverse_bytes_in_word) {
-            // swap bytes
-            packed = __builtin_bswap16(packed);
+        return color->luma >> (8 - colorspace->depth);
+    }
+    uint16_t packed = color->rgb565;
+    if (colorspace->reverse_bytes_in_word) {
+        // swap bytes
+        packed = __builtin_bswap16(packed);
+    }
+    return packed;
+}
+
+// Only the fields _convert_color uses matter.
+static bool _same_conversion(const _displayio_colorspace_t* a, const _displayio_colorspace_t* b) {
+    return a->depth == b->depth &&
+        a->grayscale == b->grayscale &&
+        a->tricolor == b->tricolor &&
+        a->tricolor_hue == b->tricolor_hue &&
+        a->reverse_bytes_in_word == b->reverse_bytes_in_word;
+}
+
+const uint16_t* displayio_palette_get_converted_colors(displayio_palette_t *self, const _displayio_colorspace_t* colorspace) {
+    uint16_t* converted_colors = self->converted_colors;
+    _displayio_colorspace_t* cached_colorspace = &self->cached_colorspace;
+    bool* valid = &self->cache_valid;
+    if (self->cache_valid && !_same_conversion(&self->cached_colorspace, colorspace)) {
+        displayio_palette_cache_t* cache = self->other_caches;
+        while (cache != NULL && cache->valid && !_same_conversion(&cache->colorspace, colorspace)) {
+            cache = cache->next;
+        }
+        // Add a table for a new colorspace. Palettes that aren't on the heap, like the
+        // supervisor's, and palettes that don't fit share their first table instead.
+        if (cache == NULL && gc_nbytes(self) > 0) {
+            cache = m_malloc_maybe(sizeof(displayio_palette_cache_t) + self->color_count * sizeof(uint16_t), false);
+            if (cache != NULL) {
+                cache->valid = false;
+                cache->next = self->other_caches;
+                self->other_caches = cache;
+            }
+        }
+        if (cache != NULL) {
+            converted_colors = cache->converted_colors;
+            cached_colorspace = &cache->colorspace;
+            valid = &cache->valid;
+        } else {
+            self->cache_valid = false;
         }
-        *color = packed;
     }
+    if (*valid) {
+        return converted_colors;
+    }
+    for (uint32_t i = 0; i < self->color_count; i++) {
+        converted_colors[i] = _convert_color(&self->colors[i], colorspace);
+    }
+    *cached_colorspace = *colorspace;
+    *valid = true;
+    return converted_colors;
+}
+
+bool displayio_palette_get_color(displayio_palette_t *self, const _displayio_colorspace_t* colorspace, uint32_t palette_index, uint32_t* color) {
+    return displayio_palette_get_converted_color(self, displayio_palette_get_converted_colors(self, colorspace), palette_index, color);
+}
 
-    return true;
+bool displayio_palette_is_opaque(displayio_palette_t *self) {
+    return self->transparent_count == 0;
 }
 
 bool displayio_palette_needs_refresh(displayio_palette_t *self) {
@@ -68,16 +68,43 @@ typedef struct {
     bool opaque;
 } displayio_output_pixel_t;
 
+// The colors converted into a colorspace other than the palette's first.
+typedef struct _displayio_palette_cache_t {
+    struct _displayio_palette_cache_t* next;
+    _displayio_colorspace_t colorspace;
+    bool valid;
+    uint16_t converted_colors[];
+} displayio_palette_cache_t;
+
 typedef struct {
     mp_obj_base_t base;
     _displayio_color_t* colors;
+    uint16_t* converted_colors; // colors converted into cached_colorspace.
+    displayio_palette_cache_t* other_caches; // one for each other colorspace the palette is shown in.
     uint32_t color_count;
+    uint32_t transparent_count;
+    _displayio_colorspace_t cached_colorspace;
+    bool cache_valid;
     bool needs_refresh;
 } displayio_palette_t;
 
 // Returns false if color fetch did not succeed (out of range or transparent).
 // Returns true if color is opaque, and sets color.
 bool displayio_palette_get_color(displayio_palette_t *palette, const _displayio_colorspace_t* colorspace, uint32_t palette_index, uint32_t* color);
+// Returns every color converted into the given colorspace so that a pixel only needs an indexed
+// load. There is a table for each colorspace, rebuilt lazily after a color changes.
+const uint16_t* displayio_palette_get_converted_colors(displayio_palette_t *self, const _displayio_colorspace_t* colorspace);
+// Looks a color up in a table from displayio_palette_get_converted_colors. Fetch the table once
+// per area and use this for each pixel. Returns false like displayio_palette_get_color.
+static inline bool displayio_palette_get_converted_color(const displayio_palette_t *self, const uint16_t* converted_colors, uint32_t palette_index, uint32_t* color) {
+    if (palette_index >= self->color_count || self->colors[palette_index].transparent) {
+        return false;
+    }
+    *color = converted_colors[palette_index];
+    return true;
+}
+// Returns true if no color in the palette is transparent.
+bool displayio_palette_is_opaque(displayio_palette_t *self);
 bool displayio_palette_needs_refresh(displayio_palette_t *self);
 void displayio_palette_finish_refresh(displayio_palette_t *self);
 
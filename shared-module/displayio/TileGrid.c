@@ -66,6 +66,12 @@ void common_hal_displayio_tilegrid_construct(displayio_tilegrid_t *self, mp_obj_
     self->tile_height = tile_height;
     self->bitmap = bitmap;
     self->pixel_shader = pixel_shader;
+    // A TileGrid showing a whole Bitmap forwards each of the bitmap's dirty bands so it needs room
+    // to transform all of them. The first goes into dirty_area.
+    self->bitmap_dirty_areas = NULL;
+    if (self->tiles_in_bitmap == 1 && MP_OBJ_IS_TYPE(bitmap, &displayio_bitmap_type)) {
+        self->bitmap_dirty_areas = m_malloc((DISPLAYIO_BITMAP_DIRTY_BANDS - 1) * sizeof(displayio_area_t), false);
+    }
     self->in_group = false;
     self->hidden = false;
     self->hidden_by_parent = false;
@@ -310,7 +316,67 @@ void common_hal_displayio_tilegrid_set_top_left(displayio_tilegrid_t *self, uint
     self->full_change = true;
 }
 
-bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self, const _displayio_colorspace_t* colorspace, const displayio_area_t* area, uint32_t* mask, uint32_t *buffer) {
+// Renders a palette mapped 1, 2, 4 or 8 bit Bitmap into an RGB565 buffer with no scaling or
+// transposition. Each output row is walked one tile run at a time so the tile lookup is done once
+// per run instead of once per pixel. Opaque layers leave the mask to the caller. Returns false if
+// any pixel drawn was transparent.
+static bool _fill_area_palette_rgb565(displayio_tilegrid_t *self, uint8_t* tiles,
+        const _displayio_colorspace_t* colorspace, uint32_t* mask, uint16_t* buffer,
+        int16_t start, int16_t y_stride, int16_t y_shift,
+        int16_t start_x, int16_t end_x, int16_t start_y, int16_t end_y, bool opaque) {
+    displayio_bitmap_t* bitmap = self->bitmap;
+    displayio_palette_t* palette = self->pixel_shader;
+    uint8_t bits_per_value = bitmap->bits_per_value;
+    uint8_t bits_per_word = sizeof(size_t) * 8;
+    const uint16_t* converted_colors = displayio_palette_get_converted_colors(palette, colorspace);
+    bool full_coverage = true;
+
+    for (int16_t y = start_y; y < end_y; ++y) {
+        // Buffer offset of input x == 0 for this row.
+        int32_t row_start = start + (y - start_y + y_shift) * y_stride - start_x;
+        uint16_t tile_row = ((y / self->tile_height + self->top_left_y) % self->height_in_tiles) * self->width_in_tiles;
+        uint16_t y_in_tile = y % self->tile_height;
+        int16_t x = start_x;
+        while (x < end_x) {
+            uint16_t x_in_tile = x % self->tile_width;
+            int16_t run = self->tile_width - x_in_tile;
+            if (run > end_x - x) {
+                run = end_x - x;
+            }
+            uint8_t tile = tiles[tile_row + (x / self->tile_width + self->top_left_x) % self->width_in_tiles];
+            uint16_t bitmap_x = (tile % self->bitmap_width_in_tiles) * self->tile_width + x_in_tile;
+            uint16_t bitmap_y = (tile / self->bitmap_width_in_tiles) * self->tile_height + y_in_tile;
+            const size_t* bitmap_row = bitmap->data + bitmap_y * bitmap->stride;
+            uint32_t offset = row_start + x;
+            for (int16_t i = 0; i < run; i++, offset++, bitmap_x++) {
+                uint32_t bit = 1u << (offset % 32);
+                if ((mask[offset / 32] & bit) != 0) {
+                    continue;
+                }
+                uint32_t value;
+                if (bits_per_value == 8) {
+                    value = ((const uint8_t*) bitmap_row)[bitmap_x];
+                } else {
+                    size_t word = bitmap_row[bitmap_x >> bitmap->x_shift];
+                    value = (word >> (bits_per_word - ((bitmap_x & bitmap->x_mask) + 1) * bits_per_value)) & bitmap->bitmask;
+                }
+                if (!opaque) {
+                    if (value >= palette->color_count || palette->colors[value].transparent) {
+                        full_coverage = false;
+                        continue;
+                    }
+                    mask[offset / 32] |= bit;
+                }
+                buffer[offset] = converted_colors[value];
+            }
+            x += run;
+        }
+    }
+    return full_coverage;
+}
+
+bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self, const _displayio_colorspace_t* colorspace, const displayio_area_t* area, uint32_t* mask, uint32_t *buffer, bool* filled_mask) {
+    *filled_mask = false;
     // If no tiles are present we have no impact.
     uint8_t* tiles = self->tiles;
     if (self->inline_tiles) {
@@ -356,11 +422,11 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self, const _displayio_c
     // layers at that point.
     bool full_coverage = displayio_area_equal(area, &overlap);
 
-    // TODO(tannewt): Skip coverage tracking if all pixels outside the overlap have already been
-    // set and our palette is all opaque.
+    // Skip the layer entirely when layers above it have already drawn every pixel it overlaps.
+    if (displayio_area_mask_covered(area, &overlap, mask)) {
+        return full_coverage;
+    }
 
-    // TODO(tannewt): Check to see if the pixel_shader has any transparency. If it doesn't then we
-    // can either return full coverage or bulk update the mask.
     displayio_area_t transformed;
     displayio_area_transform_within(flip_x != (self->absolute_transform->dx < 0), flip_y != (self->absolute_transform->dy < 0), self->transpose_xy != self->absolute_transform->transpose_xy,
                                     &overlap,
@@ -395,8 +461,52 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self, const _displayio_c
         y_shift = temp_shift;
     }
 
+    // Resolve the source and shader types once rather than for every pixel.
+    bool bitmap_is_bitmap = MP_OBJ_IS_TYPE(self->bitmap, &displayio_bitmap_type);
+    bool bitmap_is_shape = MP_OBJ_IS_TYPE(self->bitmap, &displayio_shape_type);
+    bool bitmap_is_ondisk = MP_OBJ_IS_TYPE(self->bitmap, &displayio_ondiskbitmap_type);
+    bool shader_is_palette = MP_OBJ_IS_TYPE(self->pixel_shader, &displayio_palette_type);
+    bool shader_is_colorconverter = MP_OBJ_IS_TYPE(self->pixel_shader, &displayio_colorconverter_type);
+
+    // An opaque layer draws every pixel in the overlap that isn't already masked so we skip per
+    // pixel mask updates and fill the mask for the whole overlap once we're done.
+    bool opaque = false;
+    if (self->pixel_shader == mp_const_none) {
+        opaque = true;
+    } else if (shader_is_palette && bitmap_is_bitmap) {
+        // Bitmap values past the end of the palette are transparent.
+        uint8_t bits_per_value = ((displayio_bitmap_t*) self->bitmap)->bits_per_value;
+        opaque = displayio_palette_is_opaque(self->pixel_shader) && bits_per_value < 32 &&
+            (1u << bits_per_value) <= ((displayio_palette_t*) self->pixel_shader)->color_count;
+    } else if (shader_is_colorconverter) {
+        opaque = displayio_colorconverter_is_opaque(self->pixel_shader, colorspace);
+    }
+
+    // Unscaled, untransposed, palette mapped bitmaps into RGB565 are by far the most common case
+    // so render them a tile run at a time.
+    if (bitmap_is_bitmap && shader_is_palette && x_stride == 1 &&
+        self->absolute_transform->scale == 1 &&
+        colorspace->depth == 16 && !colorspace->grayscale && !colorspace->tricolor) {
+        uint8_t bits_per_value = ((displayio_bitmap_t*) self->bitmap)->bits_per_value;
+        if (bits_per_value == 1 || bits_per_value == 2 || bits_per_value == 4 || bits_per_value == 8) {
+            bool spans_covered = _fill_area_palette_rgb565(self, tiles, colorspace, mask, (uint16_t*) buffer,
+                start + x_shift, y_stride, y_shift, start_x, end_x, start_y, end_y, opaque);
+            if (opaque) {
+                displayio_area_fill_mask(area, &overlap, mask);
+                *filled_mask = true;
+            }
+            return full_coverage && spans_covered;
+        }
+    }
+
     uint8_t pixels_per_byte = 8 / colorspace->depth;
 
+    // Convert the palette into the colorspace up front so each pixel is an indexed load.
+    const uint16_t* converted_colors = NULL;
+    if (shader_is_palette) {
+        converted_colors = displayio_palette_get_converted_colors(self->pixel_shader, colorspace);
+    }
+
     displayio_input_pixel_t input_pixel;
     displayio_output_pixel_t output_pixel;
 
@@ -428,27 +538,29 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self, const _displayio_c
 
             // We always want to read bitmap pixels by row first and then transpose into the destination
             // buffer because most bitmaps are row associated.
-            if (MP_OBJ_IS_TYPE(self->bitmap, &displayio_bitmap_type)) {
+            if (bitmap_is_bitmap) {
                 input_pixel.pixel = common_hal_displayio_bitmap_get_pixel(self->bitmap, input_pixel.tile_x, input_pixel.tile_y);
-            } else if (MP_OBJ_IS_TYPE(self->bitmap, &displayio_shape_type)) {
+            } else if (bitmap_is_shape) {
                 input_pixel.pixel = common_hal_displayio_shape_get_pixel(self->bitmap, input_pixel.tile_x, input_pixel.tile_y);
-            } else if (MP_OBJ_IS_TYPE(self->bitmap, &displayio_ondiskbitmap_type)) {
+            } else if (bitmap_is_ondisk) {
                 input_pixel.pixel = common_hal_displayio_ondiskbitmap_get_pixel(self->bitmap, input_pixel.tile_x, input_pixel.tile_y);
             }
 
             output_pixel.opaque = true;
             if (self->pixel_shader == mp_const_none) {
                 output_pixel.pixel = input_pixel.pixel;
-            } else if (MP_OBJ_IS_TYPE(self->pixel_shader, &displayio_palette_type)) {
-                output_pixel.opaque = displayio_palette_get_color(self->pixel_shader, colorspace, input_pixel.pixel, &output_pixel.pixel);
-            } else if (MP_OBJ_IS_TYPE(self->pixel_shader, &displayio_colorconverter_type)) {
+            } else if (shader_is_palette) {
+                output_pixel.opaque = displayio_palette_get_converted_color(self->pixel_shader, converted_colors, input_pixel.pixel, &output_pixel.pixel);
+            } else if (shader_is_colorconverter) {
                 displayio_colorconverter_convert(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
             }
             if (!output_pixel.opaque) {
                 // A pixel is transparent so we haven't fully covered the area ourselves.
                 full_coverage = false;
             } else {
-                mask[offset / 32] |= 1 << (offset % 32);
+                if (!opaque) {
+                    mask[offset / 32] |= 1 << (offset % 32);
+                }
                 if (colorspace->depth == 16) {
                     *(((uint16_t*) buffer) + offset) = output_pixel.pixel;
                 } else if (colorspace->depth == 8) {
@@ -476,6 +588,10 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self, const _displayio_c
             }
         }
     }
+    if (opaque) {
+        displayio_area_fill_mask(area, &overlap, mask);
+        *filled_mask = true;
+    }
     return full_coverage;
 }
 
@@ -508,6 +624,33 @@ void displayio_tilegrid_finish_refresh(displayio_tilegrid_t *self) {
     // That way they won't change during a refresh and tear.
 }
 
+// Converts an area relative to the TileGrid into absolute screen coordinates.
+static void _transform_dirty_area(displayio_tilegrid_t *self, displayio_area_t* area) {
+    if (self->absolute_transform->transpose_xy) {
+        int16_t x1 = area->x1;
+        area->x1 = self->absolute_transform->x + self->absolute_transform->dx * (self->y + area->y1);
+        area->y1 = self->absolute_transform->y + self->absolute_transform->dy * (self->x + x1);
+        int16_t x2 = area->x2;
+        area->x2 = self->absolute_transform->x + self->absolute_transform->dx * (self->y + area->y2);
+        area->y2 = self->absolute_transform->y + self->absolute_transform->dy * (self->x + x2);
+    } else {
+        area->x1 = self->absolute_transform->x + self->absolute_transform->dx * (self->x + area->x1);
+        area->y1 = self->absolute_transform->y + self->absolute_transform->dy * (self->y + area->y1);
+        area->x2 = self->absolute_transform->x + self->absolute_transform->dx * (self->x + area->x2);
+        area->y2 = self->absolute_transform->y + self->absolute_transform->dy * (self->y + area->y2);
+    }
+    if (area->y2 < area->y1) {
+        int16_t temp = area->y2;
+        area->y2 = area->y1;
+        area->y1 = temp;
+    }
+    if (area->x2 < area->x1) {
+        int16_t temp = area->x2;
+        area->x2 = area->x1;
+        area->x1 = temp;
+    }
+}
+
 displayio_area_t* displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *self, displayio_area_t* tail) {
     bool first_draw = self->previous_area.x1 == self->previous_area.x2;
     bool hidden = self->hidden || self->hidden_by_parent;
@@ -531,13 +674,22 @@ displayio_area_t* displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *sel
     }
 
     // If we have an in-memory bitmap, then check it for modifications.
+    int8_t extra_dirty_areas = 0;
     if (MP_OBJ_IS_TYPE(self->bitmap, &displayio_bitmap_type)) {
         displayio_area_t* refresh_area = displayio_bitmap_get_refresh_areas(self->bitmap, tail);
         if (refresh_area != tail) {
             // Special case a TileGrid that shows a full bitmap and use its
-            // dirty area. Copy it to ours so we can transform it.
+            // dirty areas. Copy them to ours so we can transform them.
             if (self->tiles_in_bitmap == 1) {
                 displayio_area_copy(refresh_area, &self->dirty_area);
+                for (const displayio_area_t* band = refresh_area->next; band != tail; band = band->next) {
+                    if (self->bitmap_dirty_areas == NULL) {
+                        displayio_area_union(&self->dirty_area, band, &self->dirty_area);
+                    } else {
+                        displayio_area_copy(band, &self->bitmap_dirty_areas[extra_dirty_areas]);
+                        extra_dirty_areas++;
+                    }
+                }
                 self->partial_change = true;
             } else {
                 self->full_change = true;
@@ -556,30 +708,13 @@ displayio_area_t* displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *sel
     }
 
     if (self->partial_change) {
-        if (self->absolute_transform->transpose_xy) {
-            int16_t x1 = self->dirty_area.x1;
-            self->dirty_area.x1 = self->absolute_transform->x + self->absolute_transform->dx * (self->y + self->dirty_area.y1);
-            self->dirty_area.y1 = self->absolute_transform->y + self->absolute_transform->dy * (self->x + x1);
-            int16_t x2 = self->dirty_area.x2;
-            self->dirty_area.x2 = self->absolute_transform->x + self->absolute_transform->dx * (self->y + self->dirty_area.y2);
-            self->dirty_area.y2 = self->absolute_transform->y + self->absolute_transform->dy * (self->x + x2);
-        } else {
-            self->dirty_area.x1 = self->absolute_transform->x + self->absolute_transform->dx * (self->x + self->dirty_area.x1);
-            self->dirty_area.y1 = self->absolute_transform->y + self->absolute_transform->dy * (self->y + self->dirty_area.y1);
-            self->dirty_area.x2 = self->absolute_transform->x + self->absolute_transform->dx * (self->x + self->dirty_area.x2);
-            self->dirty_area.y2 = self->absolute_transform->y + self->absolute_transform->dy * (self->y + self->dirty_area.y2);
-        }
-        if (self->dirty_area.y2 < self->dirty_area.y1) {
-            int16_t temp = self->dirty_area.y2;
-            self->dirty_area.y2 = self->dirty_area.y1;
-            self->dirty_area.y1 = temp;
+        for (int8_t i = extra_dirty_areas - 1; i >= 0; i--) {
+            displayio_area_t* area = &self->bitmap_dirty_areas[i];
+            _transform_dirty_area(self, area);
+            area->next = tail;
+            tail = area;
         }
-        if (self->dirty_area.x2 < self->dirty_area.x1) {
-            int16_t temp = self->dirty_area.x2;
-            self->dirty_area.x2 = self->dirty_area.x1;
-            self->dirty_area.x1 = temp;
-        }
-
+        _transform_dirty_area(self, &self->dirty_area);
         self->dirty_area.next = tail;
         return &self->dirty_area;
     }
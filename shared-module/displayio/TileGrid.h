@@ -53,6 +53,7 @@ typedef struct {
     uint8_t* tiles;
     const displayio_buffer_transform_t* absolute_transform;
     displayio_area_t dirty_area; // Stored as a relative area until the refresh area is fetched.
+    displayio_area_t* bitmap_dirty_areas; // Further bitmap bands when showing a whole Bitmap.
     displayio_area_t previous_area; // Stored as an absolute area.
     displayio_area_t current_area; // Stored as an absolute area so it applies across frames.
     bool partial_change :1;
@@ -76,8 +77,8 @@ void displayio_tilegrid_set_hidden_by_parent(displayio_tilegrid_t *self, bool hi
 displayio_area_t* displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *self, displayio_area_t* tail);
 
 // Area is always in absolute screen coordinates. Update transform is used to inform TileGrids how
-// they relate to it.
-bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self, const _displayio_colorspace_t* colorspace, const displayio_area_t* area, uint32_t* mask, uint32_t *buffer);
+// they relate to it. filled_mask is set when an opaque tilegrid filled the mask for its whole overlap.
+bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self, const _displayio_colorspace_t* colorspace, const displayio_area_t* area, uint32_t* mask, uint32_t *buffer, bool* filled_mask);
 void displayio_tilegrid_update_transform(displayio_tilegrid_t *group, const displayio_buffer_transform_t* parent_transform);
 
 // Fills in area with the maximum bounds of all related pixels in the last rendered frame. Returns
@@ -27,7 +27,10 @@
 #ifndef MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_AREA_H
 #define MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_AREA_H
 
-// Implementations are in __init__.c
+#include <stdbool.h>
+#include <stdint.h>
+
+// Implementations are in area.c
 typedef struct _displayio_area_t displayio_area_t;
 
 struct _displayio_area_t {
@@ -65,6 +68,11 @@ uint16_t displayio_area_width(const displayio_area_t* area);
 uint16_t displayio_area_height(const displayio_area_t* area);
 uint32_t displayio_area_size(const displayio_area_t* area);
 bool displayio_area_equal(const displayio_area_t* a, const displayio_area_t* b);
+// Masks have one bit per pixel of area, ordered row by row. Sub must be non-empty and within area.
+// Sets the mask bit of every pixel in sub.
+void displayio_area_fill_mask(const displayio_area_t* area, const displayio_area_t* sub, uint32_t* mask);
+// Returns true if the mask bit of every pixel in sub is already set.
+bool displayio_area_mask_covered(const displayio_area_t* area, const displayio_area_t* sub, const uint32_t* mask);
 void displayio_area_transform_within(bool mirror_x, bool mirror_y, bool transpose_xy,
                                      const displayio_area_t* original,
                                      const displayio_area_t* whole,
@@ -57,6 +57,7 @@ void displayio_display_core_construct(displayio_display_core_t* self,
     self->colstart = colstart;
     self->rowstart = rowstart;
     self->last_refresh = 0;
+    self->refresh_area_overhead = DISPLAYIO_DEFAULT_REFRESH_AREA_OVERHEAD;
 
     // (framebufferdisplay already validated its 'bus' is a buffer-protocol object)
     if (bus) {
@@ -297,6 +298,8 @@ void displayio_display_core_set_region_to_update(displayio_display_core_t* self,
 
 void displayio_display_core_start_refresh(displayio_display_core_t* self) {
     self->last_refresh = supervisor_ticks_ms64();
+    self->render_us = 0;
+    self->transfer_us = 0;
 }
 
 void displayio_display_core_finish_refresh(displayio_display_core_t* self) {
@@ -349,3 +352,64 @@ bool displayio_display_core_clip_area(displayio_display_core_t *self, const disp
     }
     return true;
 }
+
+// Returns how many more pixels refreshing the union of a and b costs than refreshing them
+// separately. Separate refreshes pay the transaction overhead twice and draw any overlap twice.
+static int64_t _merge_cost(const displayio_area_t* a, const displayio_area_t* b, uint32_t overhead) {
+    displayio_area_t u;
+    displayio_area_union(a, b, &u);
+    return (int64_t) displayio_area_size(&u) - displayio_area_size(a) - displayio_area_size(b) - overhead;
+}
+
+const displayio_area_t* displayio_display_core_plan_refresh(displayio_display_core_t *self, const displayio_area_t* dirty, displayio_area_t* areas) {
+    uint8_t count = 0;
+    for (; dirty != NULL; dirty = dirty->next) {
+        displayio_area_t candidate;
+        if (!displayio_area_compute_overlap(&self->area, dirty, &candidate)) {
+            continue;
+        }
+        // Absorb every planned area that is cheaper to refresh together with the candidate. Growing
+        // the candidate may make earlier areas worth merging so restart after each merge.
+        for (int16_t i = 0; i < count; i++) {
+            if (_merge_cost(&candidate, &areas[i], self->refresh_area_overhead) <= 0) {
+                displayio_area_union(&candidate, &areas[i], &candidate);
+                areas[i] = areas[--count];
+                i = -1;
+            }
+        }
+        // Out of room so merge into the area where it adds the least overdraw.
+        while (count == DISPLAYIO_MAX_REFRESH_AREAS) {
+            uint8_t best = 0;
+            int64_t best_cost = INT64_MAX;
+            for (uint8_t i = 0; i < count; i++) {
+                int64_t cost = _merge_cost(&candidate, &areas[i], self->refresh_area_overhead);
+                if (cost < best_cost) {
+                    best = i;
+                    best_cost = cost;
+                }
+            }
+            displayio_area_union(&candidate, &areas[best], &candidate);
+            areas[best] = areas[--count];
+        }
+        areas[count++] = candidate;
+    }
+    // Refresh top to bottom so updates follow the panel's scan direction.
+    for (uint8_t i = 1; i < count; i++) {
+        displayio_area_t area = areas[i];
+        uint8_t j = i;
+        while (j > 0 && (areas[j - 1].y1 > area.y1 ||
+                         (areas[j - 1].y1 == area.y1 && areas[j - 1].x1 > area.x1))) {
+            areas[j] = areas[j - 1];
+            j--;
+        }
+        areas[j] = area;
+    }
+    if (count == 0) {
+        return NULL;
+    }
+    for (uint8_t i = 0; i < count - 1; i++) {
+        areas[i].next = &areas[i + 1];
+    }
+    areas[count - 1].next = NULL;
+    return &areas[0];
+}
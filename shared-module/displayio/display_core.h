@@ -34,10 +34,17 @@
 
 #define NO_COMMAND 0x100
 
+// Maximum number of separate areas refreshed in one frame. More dirty areas are merged together.
+#define DISPLAYIO_MAX_REFRESH_AREAS (8)
+// Default cost of starting another refresh transaction, in pixels.
+#define DISPLAYIO_DEFAULT_REFRESH_AREA_OVERHEAD (256)
+
 typedef struct {
     mp_obj_t bus;
     displayio_group_t *current_group;
     uint64_t last_refresh;
+    uint32_t render_us; // Time spent compositing during the last refresh.
+    uint32_t transfer_us; // Time spent sending pixels during the last refresh.
     display_bus_bus_reset bus_reset;
     display_bus_bus_free bus_free;
     display_bus_begin_transaction begin_transaction;
@@ -53,6 +60,7 @@ typedef struct {
     _displayio_colorspace_t colorspace;
     int16_t colstart;
     int16_t rowstart;
+    uint32_t refresh_area_overhead; // Pixels worth of work each extra refresh area costs.
     bool full_refresh; // New group means we need to refresh the whole display.
 } displayio_display_core_t;
 
@@ -87,4 +95,8 @@ bool displayio_display_core_fill_area(displayio_display_core_t *self, displayio_
 
 bool displayio_display_core_clip_area(displayio_display_core_t *self, const displayio_area_t* area, displayio_area_t* clipped);
 
+// Clips, merges and orders the linked list of dirty areas into at most DISPLAYIO_MAX_REFRESH_AREAS
+// areas linked top to bottom. Returns the first area or NULL if nothing needs a refresh.
+const displayio_area_t* displayio_display_core_plan_refresh(displayio_display_core_t *self, const displayio_area_t* dirty, displayio_area_t* areas);
+
 #endif // MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_DISPLAY_CORE_H
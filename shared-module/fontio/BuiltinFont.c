@@ -42,10 +42,21 @@ mp_obj_t common_hal_fontio_builtinfont_get_bounding_box(const fontio_builtinfont
     return mp_obj_new_tuple(2, items);
 }
 
-uint8_t fontio_builtinfont_get_glyph_index(const fontio_builtinfont_t *self, mp_uint_t codepoint) {
-    if (codepoint >= 0x20 && codepoint <= 0x7e) {
-        return codepoint - 0x20;
-    }
+// Non-ASCII glyphs are found by decoding the font's UTF-8 list of characters. Remember recent
+// answers, including misses, in a small direct-mapped table so repeated characters such as box
+// drawing in console output don't decode the whole list every time. Builtin fonts are static so
+// the font pointers stay valid.
+#define GLYPH_CACHE_SIZE (16)
+
+typedef struct {
+    const fontio_builtinfont_t* font;
+    mp_uint_t codepoint;
+    uint8_t glyph_index;
+} glyph_cache_entry_t;
+
+static glyph_cache_entry_t glyph_cache[GLYPH_CACHE_SIZE];
+
+static uint8_t find_glyph_index(const fontio_builtinfont_t *self, mp_uint_t codepoint) {
     // Do a linear search of the mapping for unicode.
     const byte* j = self->unicode_characters;
     uint8_t k = 0;
@@ -60,6 +71,19 @@ uint8_t fontio_builtinfont_get_glyph_index(const fontio_builtinfont_t *self, mp_
     return 0xff;
 }
 
+uint8_t fontio_builtinfont_get_glyph_index(const fontio_builtinfont_t *self, mp_uint_t codepoint) {
+    if (codepoint >= 0x20 && codepoint <= 0x7e) {
+        return codepoint - 0x20;
+    }
+    glyph_cache_entry_t* entry = &glyph_cache[(codepoint ^ (codepoint >> 4)) % GLYPH_CACHE_SIZE];
+    if (entry->font != self || entry->codepoint != codepoint) {
+        entry->font = self;
+        entry->codepoint = codepoint;
+        entry->glyph_index = find_glyph_index(self, codepoint);
+    }
+    return entry->glyph_index;
+}
+
 mp_obj_t common_hal_fontio_builtinfont_get_glyph(const fontio_builtinfont_t *self, mp_uint_t codepoint) {
     uint8_t glyph_index = fontio_builtinfont_get_glyph_index(self, codepoint);
     if (glyph_index == 0xff) {
@@ -33,6 +33,30 @@ uint32_t common_hal_vectorio_circle_get_pixel(void *obj, int16_t x, int16_t y) {
 }
 
 
+uint16_t common_hal_vectorio_circle_get_spans(void *obj, int16_t y, int16_t *spans, uint16_t max_spans) {
+    vectorio_circle_t *self = obj;
+    int16_t radius = abs(self->radius);
+    y = abs(y);
+    if (y > radius) {
+        return 0;
+    }
+    // The row is inside out to the largest x with x*x + y*y <= radius*radius. This covers the
+    // x + y <= radius shortcut in get_pixel too.
+    int32_t limit = (int32_t)radius*radius - (int32_t)y*y;
+    int32_t x = 0;
+    for (int32_t bit = 1 << 14; bit > 0; bit >>= 1) {
+        if ((x + bit) * (x + bit) <= limit) {
+            x += bit;
+        }
+    }
+    if (max_spans > 0) {
+        spans[0] = -x;
+        spans[1] = x + 1;
+    }
+    return 1;
+}
+
+
 void common_hal_vectorio_circle_get_area(void *circle, displayio_area_t *out_area) {
     vectorio_circle_t *self = circle;
     out_area->x1 = -1 * self->radius - 1;
@@ -30,7 +30,11 @@ static void _clobber_points_list(vectorio_polygon_t *self, mp_obj_t points_tuple
         if ( self->points_list != NULL ) {
             gc_free( self->points_list );
         }
+        if ( self->crossings != NULL ) {
+            gc_free( self->crossings );
+        }
         self->points_list = gc_alloc( 2 * len * sizeof(int), false, false );
+        self->crossings = gc_alloc( len * sizeof(int32_t), false, false );
     }
     self->len = 2*len;
 
@@ -48,6 +52,8 @@ static void _clobber_points_list(vectorio_polygon_t *self, mp_obj_t points_tuple
             self->len = 0;
             gc_free( self->points_list );
             self->points_list = NULL;
+            gc_free( self->crossings );
+            self->crossings = NULL;
             mp_raise_ValueError_varg(translate("unsupported %q type"), MP_QSTR_point);
         }
     }
@@ -58,6 +64,7 @@ static void _clobber_points_list(vectorio_polygon_t *self, mp_obj_t points_tuple
 void common_hal_vectorio_polygon_construct(vectorio_polygon_t *self, mp_obj_t points_list) {
     VECTORIO_POLYGON_DEBUG("%p polygon_construct\n", self);
     self->points_list = NULL;
+    self->crossings = NULL;
     self->len = 0;
     self->on_dirty.obj = NULL;
     _clobber_points_list( self, points_list );
@@ -144,3 +151,77 @@ uint32_t common_hal_vectorio_polygon_get_pixel(void *obj, int16_t x, int16_t y)
     }
     return winding_number == 0 ? 0 : 1;
 }
+
+
+// Computes the same winding number as get_pixel for a whole row at once. An edge that spans row y
+// adds +1 (upward) or -1 (downward) to every pixel strictly to the right of it, which is every
+// x >= x1 + floor((y - y1) * (x2 - x1) / (y2 - y1)) + 1. Sorting those thresholds gives the runs
+// where the winding number is non-zero.
+uint16_t common_hal_vectorio_polygon_get_spans(void *obj, int16_t y, int16_t *spans, uint16_t max_spans) {
+    vectorio_polygon_t *self = obj;
+
+    if (self->len == 0) {
+        return 0;
+    }
+    if (self->crossings == NULL) {
+        return max_spans + 1;
+    }
+
+    // Crossings are stored as threshold * 2 plus 1 for upward edges, kept sorted by threshold.
+    size_t crossing_count = 0;
+    int x1 = self->points_list[self->len - 2];
+    int y1 = self->points_list[self->len - 1];
+    for (size_t i = 0; i < self->len; i += 2) {
+        int x2 = self->points_list[i];
+        int y2 = self->points_list[i + 1];
+        int wind = 0;
+        if ( y1 <= y ) {
+            if ( y2 > y ) {
+                wind = 1;
+            }
+        } else if ( y2 <= y ) {
+            wind = -1;
+        }
+        if (wind != 0) {
+            int numerator = (y - y1) * (x2 - x1);
+            int denominator = y2 - y1;
+            int quotient = numerator / denominator;
+            if (numerator % denominator != 0 && (numerator < 0) != (denominator < 0)) {
+                quotient--;
+            }
+            int32_t crossing = (x1 + quotient + 1) * 2 + (wind > 0 ? 1 : 0);
+            size_t j = crossing_count;
+            while (j > 0 && self->crossings[j - 1] > crossing) {
+                self->crossings[j] = self->crossings[j - 1];
+                j--;
+            }
+            self->crossings[j] = crossing;
+            crossing_count++;
+        }
+        x1 = x2;
+        y1 = y2;
+    }
+
+    uint16_t span_count = 0;
+    int winding_number = 0;
+    int32_t span_start = 0;
+    for (size_t i = 0; i < crossing_count;) {
+        int32_t threshold = (self->crossings[i] - (self->crossings[i] & 1)) / 2;
+        int new_winding_number = winding_number;
+        // Apply every crossing at this x before deciding whether a run starts or ends.
+        for (; i < crossing_count && (self->crossings[i] - (self->crossings[i] & 1)) / 2 == threshold; ++i) {
+            new_winding_number += (self->crossings[i] & 1) ? 1 : -1;
+        }
+        if (winding_number == 0 && new_winding_number != 0) {
+            span_start = threshold;
+        } else if (winding_number != 0 && new_winding_number == 0) {
+            if (span_count < max_spans) {
+                spans[2 * span_count] = MAX(span_start, SHRT_MIN);
+                spans[2 * span_count + 1] = MIN(threshold, SHRT_MAX);
+            }
+            ++span_count;
+        }
+        winding_number = new_winding_number;
+    }
+    return span_count;
+}
@@ -11,6 +11,8 @@ typedef struct {
     // An int array[ x, y, ... ]
     int *points_list;
     size_t len;
+    // Scratch space for the edge crossings of one row, one per point.
+    int32_t *crossings;
     vectorio_event_t on_dirty;
 } vectorio_polygon_t;
 
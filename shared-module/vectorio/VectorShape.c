@@ -27,12 +27,73 @@
 // #define VECTORIO_SHAPE_PIXEL_DEBUG(...) mp_printf(&mp_plat_print __VA_OPT__(,) __VA_ARGS__)
 
 
+// Most rows of a shape are one or two runs. Rows with more than this are drawn with get_pixel.
+#define VECTORIO_MAX_SPANS (16)
+
+
 inline __attribute__((always_inline))
 static int32_t max(int32_t a, int32_t b) {
     return a > b ? a : b;
 }
 
 
+// The shape x drawn at a screen x when there is no transpose.
+inline __attribute__((always_inline))
+static int16_t _shape_x(const vectorio_vector_shape_t *self, int32_t screen_x) {
+    return (screen_x - self->absolute_transform->dx * self->x) / self->absolute_transform->dx;
+}
+
+
+inline __attribute__((always_inline))
+static bool _past_boundary(const vectorio_vector_shape_t *self, int32_t screen_x, int16_t boundary) {
+    int16_t shape_x = _shape_x(self, screen_x);
+    return self->absolute_transform->dx > 0 ? shape_x >= boundary : shape_x <= boundary;
+}
+
+
+// Finds the first screen x after x whose shape x is at or past boundary, walking the shape in the
+// direction dx gives it. dx may be scaled and the division rounds towards zero, so start at the exact
+// inverse and step to where the rounding puts the edge.
+static int32_t _run_end(const vectorio_vector_shape_t *self, int32_t x, int32_t limit, int16_t boundary) {
+    int32_t end = MIN(MAX(self->absolute_transform->dx * ((int32_t) boundary + self->x), x + 1), limit);
+    while (end > x + 1 && _past_boundary(self, end - 1, boundary)) {
+        --end;
+    }
+    while (end < limit && !_past_boundary(self, end, boundary)) {
+        ++end;
+    }
+    return end;
+}
+
+
+inline __attribute__((always_inline))
+static void _set_buffer_pixel(const _displayio_colorspace_t *colorspace, uint32_t *buffer, uint32_t pixel_index, uint32_t linestride_px, uint32_t pixel) {
+    uint8_t pixels_per_byte = 8 / colorspace->depth;
+    if (colorspace->depth == 16) {
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 16\n", pixel);
+        *(((uint16_t*) buffer) + pixel_index) = pixel;
+    } else if (colorspace->depth == 8) {
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %02x 8\n", pixel);
+        *(((uint8_t*) buffer) + pixel_index) = pixel;
+    } else if (colorspace->depth < 8) {
+        // Reorder the offsets to pack multiple rows into a byte (meaning they share a column).
+        if (!colorspace->pixels_in_byte_share_row) {
+            uint16_t width = linestride_px;
+            uint16_t row = pixel_index / width;
+            uint16_t col = pixel_index % width;
+            pixel_index = col * pixels_per_byte + (row / pixels_per_byte) * pixels_per_byte * width + row % pixels_per_byte;
+        }
+        uint8_t shift = (pixel_index % pixels_per_byte) * colorspace->depth;
+        if (colorspace->reverse_pixels_in_byte) {
+            // Reverse the shift by subtracting it from the leftmost shift.
+            shift = (pixels_per_byte - 1) * colorspace->depth - shift;
+        }
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %2d %d\n", pixel, colorspace->depth);
+        ((uint8_t*)buffer)[pixel_index / pixels_per_byte] |= pixel << shift;
+    }
+}
+
+
 inline __attribute__((always_inline))
 static void _get_screen_area(vectorio_vector_shape_t *self, displayio_area_t *out_area) {
     VECTORIO_SHAPE_DEBUG("%p get_screen_area tform:{x:%d y:%d dx:%d dy:%d scl:%d w:%d h:%d mx:%d my:%d tr:%d}", self,
@@ -190,20 +251,113 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
 
     bool full_coverage = displayio_area_equal(area, &overlap);
 
-    uint8_t pixels_per_byte = 8 / colorspace->depth;
+    if (displayio_area_mask_covered(area, &overlap, mask)) {
+        VECTORIO_SHAPE_DEBUG(" occluded\n");
+        return full_coverage;
+    }
 
     uint32_t linestride_px = displayio_area_width(area);
     uint32_t line_dirty_offset_px = (overlap.y1 - area->y1) * linestride_px;
     uint32_t column_dirty_offset_px = overlap.x1 - area->x1;
     VECTORIO_SHAPE_DEBUG(", linestride:%3d line_offset:%3d col_offset:%3d depth:%2d ppb:%2d shape:%s",
-        linestride_px, line_dirty_offset_px, column_dirty_offset_px, colorspace->depth, pixels_per_byte, mp_obj_get_type_str(self->ishape.shape));
+        linestride_px, line_dirty_offset_px, column_dirty_offset_px, colorspace->depth, 8 / colorspace->depth, mp_obj_get_type_str(self->ishape.shape));
 
     displayio_input_pixel_t input_pixel;
     displayio_output_pixel_t output_pixel;
 
+    // Without a transpose each screen row is one row of the shape so the shape can work out the
+    // whole row at once instead of testing every pixel on its own.
+    bool use_spans = self->ishape.get_spans != NULL && !self->absolute_transform->transpose_xy;
+    int16_t spans[2 * VECTORIO_MAX_SPANS];
+    uint16_t span_count = 0;
+    bool row_has_spans = false;
+
+    // Shapes only produce a couple of values so remember the last palette lookup.
+    bool palette_shader = MP_OBJ_IS_TYPE(self->pixel_shader, &displayio_palette_type);
+    bool color_converter = MP_OBJ_IS_TYPE(self->pixel_shader, &displayio_colorconverter_type);
+    const uint16_t* converted_colors = NULL;
+    if (palette_shader) {
+        converted_colors = displayio_palette_get_converted_colors(self->pixel_shader, colorspace);
+    }
+    bool have_last_color = false;
+    uint32_t last_input_pixel = 0;
+    displayio_output_pixel_t last_output_pixel;
+
     uint32_t mask_start_px = line_dirty_offset_px;
     for (input_pixel.y = overlap.y1; input_pixel.y < overlap.y2; ++input_pixel.y) {
         mask_start_px += column_dirty_offset_px;
+        if (use_spans) {
+#ifdef VECTORIO_PERF
+            uint64_t pre_pixel = common_hal_time_monotonic_ns();
+#endif
+            int16_t shape_y = (input_pixel.y - self->absolute_transform->dy * self->y) / self->absolute_transform->dy;
+            span_count = self->ishape.get_spans(self->ishape.shape, shape_y, spans, VECTORIO_MAX_SPANS);
+            row_has_spans = span_count <= VECTORIO_MAX_SPANS;
+#ifdef VECTORIO_PERF
+            pixel_time += common_hal_time_monotonic_ns() - pre_pixel;
+#endif
+        }
+        if (row_has_spans) {
+            // Walk the row a run at a time: the gaps between spans are 0 and the spans are 1, so
+            // each run needs a single palette lookup. A mirrored shape is walked from its last span.
+            int16_t dx = self->absolute_transform->dx;
+            int16_t span = dx > 0 ? 0 : span_count - 1;
+            int32_t x = overlap.x1;
+            while (x < overlap.x2) {
+                int16_t shape_x = _shape_x(self, x);
+                int32_t run_end = overlap.x2;
+                input_pixel.pixel = 0;
+                if (dx > 0) {
+                    while (span < span_count && spans[2 * span + 1] <= shape_x) {
+                        ++span;
+                    }
+                    if (span < span_count) {
+                        input_pixel.pixel = spans[2 * span] <= shape_x;
+                        run_end = _run_end(self, x, overlap.x2, spans[2 * span + input_pixel.pixel]);
+                    }
+                } else {
+                    while (span >= 0 && spans[2 * span] > shape_x) {
+                        --span;
+                    }
+                    if (span >= 0) {
+                        input_pixel.pixel = shape_x < spans[2 * span + 1];
+                        run_end = _run_end(self, x, overlap.x2, (input_pixel.pixel ? spans[2 * span] : spans[2 * span + 1]) - 1);
+                    }
+                }
+
+                output_pixel.pixel = input_pixel.pixel;
+                output_pixel.opaque = true;
+                if (palette_shader) {
+                    output_pixel.opaque = displayio_palette_get_converted_color(self->pixel_shader, converted_colors, input_pixel.pixel, &output_pixel.pixel);
+                }
+                if (!output_pixel.opaque) {
+                    full_coverage = false;
+                    x = run_end;
+                    continue;
+                }
+                for (; x < run_end; ++x) {
+                    uint32_t pixel_index = mask_start_px + (x - overlap.x1);
+                    uint32_t *mask_doubleword = &(mask[pixel_index / 32]);
+                    uint32_t mask_bit = 1u << (pixel_index % 32);
+                    if ((*mask_doubleword & mask_bit) != 0) {
+                        continue;
+                    }
+                    if (color_converter) {
+                        // Dithering depends on the position so convert every pixel.
+                        input_pixel.x = x;
+                        displayio_colorconverter_convert(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
+                        if (!output_pixel.opaque) {
+                            full_coverage = false;
+                            continue;
+                        }
+                    }
+                    *mask_doubleword |= mask_bit;
+                    _set_buffer_pixel(colorspace, buffer, pixel_index, linestride_px, output_pixel.pixel);
+                }
+            }
+            mask_start_px += linestride_px - column_dirty_offset_px;
+            continue;
+        }
         for (input_pixel.x = overlap.x1; input_pixel.x < overlap.x2; ++input_pixel.x) {
             // Check the mask first to see if the pixel has already been set.
             uint32_t pixel_index = mask_start_px + (input_pixel.x - overlap.x1);
@@ -240,9 +394,14 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
             output_pixel.opaque = true;
             if (self->pixel_shader == mp_const_none) {
                 output_pixel.pixel = input_pixel.pixel;
-            } else if (MP_OBJ_IS_TYPE(self->pixel_shader, &displayio_palette_type)) {
-                output_pixel.opaque = displayio_palette_get_color(self->pixel_shader, colorspace, input_pixel.pixel, &output_pixel.pixel);
-            } else if (MP_OBJ_IS_TYPE(self->pixel_shader, &displayio_colorconverter_type)) {
+            } else if (palette_shader) {
+                if (!have_last_color || input_pixel.pixel != last_input_pixel) {
+                    last_output_pixel.opaque = displayio_palette_get_converted_color(self->pixel_shader, converted_colors, input_pixel.pixel, &last_output_pixel.pixel);
+                    last_input_pixel = input_pixel.pixel;
+                    have_last_color = true;
+                }
+                output_pixel = last_output_pixel;
+            } else if (color_converter) {
                 displayio_colorconverter_convert(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
             }
             if (!output_pixel.opaque) {
@@ -250,28 +409,7 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
                 full_coverage = false;
             } else {
                 *mask_doubleword |= 1u << mask_bit;
-                if (colorspace->depth == 16) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 16\n", output_pixel.pixel);
-                    *(((uint16_t*) buffer) + pixel_index) = output_pixel.pixel;
-                } else if (colorspace->depth == 8) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %02x 8\n", output_pixel.pixel);
-                    *(((uint8_t*) buffer) + pixel_index) = output_pixel.pixel;
-                } else if (colorspace->depth < 8) {
-                    // Reorder the offsets to pack multiple rows into a byte (meaning they share a column).
-                    if (!colorspace->pixels_in_byte_share_row) {
-                        uint16_t width = linestride_px;
-                        uint16_t row = pixel_index / width;
-                        uint16_t col = pixel_index % width;
-                        pixel_index = col * pixels_per_byte + (row / pixels_per_byte) * pixels_per_byte * width + row % pixels_per_byte;
-                    }
-                    uint8_t shift = (pixel_index % pixels_per_byte) * colorspace->depth;
-                    if (colorspace->reverse_pixels_in_byte) {
-                        // Reverse the shift by subtracting it from the leftmost shift.
-                        shift = (pixels_per_byte - 1) * colorspace->depth - shift;
-                    }
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %2d %d\n", output_pixel.pixel, colorspace->depth);
-                    ((uint8_t*)buffer)[pixel_index / pixels_per_byte] |= output_pixel.pixel << shift;
-                }
+                _set_buffer_pixel(colorspace, buffer, pixel_index, linestride_px, output_pixel.pixel);
             }
         }
         mask_start_px += linestride_px - column_dirty_offset_px;
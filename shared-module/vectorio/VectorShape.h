@@ -11,6 +11,10 @@
 
 typedef void get_area_function(mp_obj_t shape, displayio_area_t *out_area);
 typedef uint32_t get_pixel_function(mp_obj_t shape, int16_t x, int16_t y);
+// Finds the runs of row y that get_pixel would report as 1 and all other pixels as 0. Up to
+// max_spans [x1, x2) pairs are written to spans in increasing x order. Returns the number of runs,
+// which is more than max_spans when they didn't all fit.
+typedef uint16_t get_spans_function(mp_obj_t shape, int16_t y, int16_t *spans, uint16_t max_spans);
 
 // This struct binds a shape's common Shape support functions (its vector shape interface)
 //   to its instance pointer.  We only check at construction time what the type of the
@@ -22,6 +26,7 @@ typedef struct {
     mp_obj_t shape;
     get_area_function *get_area;
     get_pixel_function *get_pixel;
+    get_spans_function *get_spans; // Optional. Rows are drawn with get_pixel when NULL.
 } vectorio_ishape_t;
 
 typedef struct {
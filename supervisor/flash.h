@@ -45,8 +45,15 @@ uint32_t supervisor_flash_get_block_count(void);
 mp_uint_t supervisor_flash_read_blocks(uint8_t *dest, uint32_t block_num, uint32_t num_blocks);
 mp_uint_t supervisor_flash_write_blocks(const uint8_t *src, uint32_t block_num, uint32_t num_blocks);
 
+// Returns the address a block can be read from in the memory map, or NULL if the flash isn't
+// memory mapped. Any cached writes are flushed first.
+const uint8_t* supervisor_flash_get_block_address(uint32_t block);
+
 struct _fs_user_mount_t;
 void supervisor_flash_init_vfs(struct _fs_user_mount_t *vfs);
+// As supervisor_flash_get_block_address but for a block as numbered by the filesystem. Returns
+// NULL if vfs isn't the one set up by supervisor_flash_init_vfs.
+const uint8_t* supervisor_flash_get_vfs_block_address(struct _fs_user_mount_t *vfs, uint32_t block_num);
 void supervisor_flash_flush(void);
 void supervisor_flash_release_cache(void);
 
@@ -210,10 +210,15 @@ _displayio_color_t blinka_colors[7] = {
     },
 };
 
+uint16_t blinka_converted_colors[7];
+
 displayio_palette_t blinka_palette = {
     .base = {.type = &displayio_palette_type },
     .colors = blinka_colors,
+    .converted_colors = blinka_converted_colors,
     .color_count = 7,
+    .transparent_count = 1,
+    .cache_valid = false,
     .needs_refresh = false
 };
 
@@ -572,6 +572,11 @@ bool external_flash_write_block(const uint8_t *data, uint32_t block) {
     }
 }
 
+const uint8_t* supervisor_flash_get_block_address(uint32_t block) {
+    // The flash is only read with (Q)SPI commands.
+    return NULL;
+}
+
 mp_uint_t supervisor_flash_read_blocks(uint8_t *dest, uint32_t block_num, uint32_t num_blocks) {
     for (size_t i = 0; i < num_blocks; i++) {
         if (!external_flash_read_block(dest + i * FILESYSTEM_BLOCK_SIZE, block_num + i)) {
@@ -201,3 +201,10 @@ void supervisor_flash_init_vfs(fs_user_mount_t *vfs) {
     vfs->u.ioctl[0] = (mp_obj_t)&supervisor_flash_obj_ioctl_obj;
     vfs->u.ioctl[1] = (mp_obj_t)&supervisor_flash_obj;
 }
+
+const uint8_t* supervisor_flash_get_vfs_block_address(fs_user_mount_t *vfs, uint32_t block_num) {
+    if (vfs->readblocks[2] != (mp_obj_t)flash_read_blocks || block_num < PART1_START_BLOCK) {
+        return NULL;
+    }
+    return supervisor_flash_get_block_address(block_num - PART1_START_BLOCK);
+}
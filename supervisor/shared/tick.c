@@ -83,6 +83,16 @@ uint32_t supervisor_ticks_ms32() {
     return supervisor_ticks_ms64();
 }
 
+uint32_t supervisor_ticks_us32() {
+    uint8_t subticks = 0;
+    common_hal_mcu_disable_interrupts();
+    uint64_t result = port_get_raw_ticks(&subticks);
+    common_hal_mcu_enable_interrupts();
+    // 32 subticks per tick and 1024 ticks per second
+    result = ((result << 5) + subticks) * 15625 / 512;
+    return result;
+}
+
 extern void run_background_tasks(void);
 
 void PLACE_IN_ITCM(supervisor_run_background_tasks_if_tick)() {
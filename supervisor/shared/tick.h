@@ -57,6 +57,11 @@ extern uint32_t supervisor_ticks_ms32(void);
  * then it may be possible to use supervisor_ticks_ms64 instead.
  */
 extern uint64_t supervisor_ticks_ms64(void);
+/** @brief Get the lower 32 bits of the time in microseconds
+ *
+ * The resolution is that of the subtick clock, about 30 microseconds.
+ */
+extern uint32_t supervisor_ticks_us32(void);
 /** @brief Run background ticks, but only about every millisecond.
  *
  * Normally, this is not called directly.  Instead use the RUN_BACKGROUND_TASKS
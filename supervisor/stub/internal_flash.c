@@ -49,6 +49,10 @@ uint32_t supervisor_flash_get_block_count(void) {
 void supervisor_flash_flush(void) {
 }
 
+const uint8_t* supervisor_flash_get_block_address(uint32_t block) {
+    return NULL;
+}
+
 mp_uint_t supervisor_flash_read_blocks(uint8_t *dest, uint32_t block, uint32_t num_blocks) {
     return 0; // success
 }
@@ -0,0 +1,41 @@
+# test that changes to a class are seen by later lookups on its instances
+
+class A:
+    x = 1
+    def f(self):
+        return 'A.f'
+
+class B(A):
+    pass
+
+def get(o):
+    return o.x, o.f()
+
+b = B()
+print(get(b))
+
+# store in a base class
+A.f = lambda self: 'new A.f'
+print(get(b))
+
+# shadow in the class of the instance
+B.x = 2
+B.f = lambda self: 'B.f'
+print(get(b))
+
+# delete again
+del B.x
+del B.f
+print(get(b))
+
+# an instance member shadows the class
+b.x = 3
+print(get(b))
+del b.x
+print(get(b))
+
+# new classes are looked up correctly
+for i in range(3):
+    class C(A):
+        x = i
+    print(get(C()))
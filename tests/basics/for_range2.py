@@ -0,0 +1,86 @@
+# test for-range loops that are compiled to the FOR_RANGE opcode
+
+def f():
+    # positive and negative steps
+    for i in range(4):
+        print(i)
+    for i in range(2, 9, 3):
+        print(i)
+    for i in range(5, 0, -2):
+        print(i)
+    for i in range(0, -5, -127):
+        print(i)
+    for i in range(0, 300, 127):
+        print(i)
+
+    # an empty range doesn't assign the loop variable
+    j = 'unchanged'
+    for j in range(3, 3):
+        pass
+    print(j)
+    for j in range(0, 3, -1):
+        pass
+    print(j)
+
+    # the loop variable keeps its last value
+    for j in range(3):
+        pass
+    print(j)
+
+    # assigning to the loop variable doesn't change the iteration
+    for i in range(3):
+        print(i)
+        i += 10
+
+    # break, continue and else
+    for i in range(10):
+        if i == 2:
+            continue
+        if i == 5:
+            break
+        print(i)
+    else:
+        print('no else')
+    for i in range(3):
+        print(i)
+    else:
+        print('else')
+    for i in range(3):
+        for j in range(10, 7, -1):
+            if j == 8:
+                break
+            print(i, j)
+        else:
+            print('no else')
+        if i == 1:
+            break
+    else:
+        print('no else')
+
+    # a return from inside the loop
+    def g(n):
+        for i in range(n):
+            if i * i > n:
+                return i
+        return -1
+    print(g(20), g(0))
+
+    # bounds that aren't small ints
+    for i in range(2 ** 70, 2 ** 70 + 3):
+        print(i)
+    for i in range(-2 ** 70, -2 ** 70 - 5, -2):
+        print(i)
+    for i in range(1 << 29, (1 << 29) + 2):
+        print(i)
+
+    # expressions as bounds
+    n = 2
+    for i in range(n - 1, n * 2):
+        print(i)
+
+f()
+
+# at the module level
+for i in range(3, 0, -1):
+    print(i)
+print(i)
@@ -0,0 +1,35 @@
+# test binary ops on locals and small int constants, which the compiler may
+# emit as single fused opcodes
+
+def f(a, b):
+    print(a + b, a - b, a < b, a > b, a == b, a <= b, a >= b, a != b, a & b)
+    print(a + 1, a - 16, a < 47, a > -16, a == 3, a & 15, a * 2, a // 3, a % 5)
+    a += 1
+    a -= 2
+    print(a)
+
+f(3, 4)
+f(-7, 100)
+f(True, 2)
+
+# non-int operands
+def g(s, t):
+    print(s + t, s * 2, s == t, s < t)
+
+g('ab', 'cd')
+g([1], [2])
+
+# locals beyond the first few
+def h():
+    x0 = x1 = x2 = x3 = x4 = x5 = x6 = x7 = x8 = x9 = x10 = x11 = x12 = x13 = x14 = 14
+    x15 = 15
+    x16 = 16
+    print(x14 + x15, x15 - x16, x16 + 1, x15 + 1, x0 < x15)
+
+h()
+
+# a jump to between the loads must not land in a fused opcode
+def w(a, b, c):
+    return a + (b if c else 1)
+
+print(w(1, 2, True), w(1, 2, False))
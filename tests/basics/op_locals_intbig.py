@@ -0,0 +1,11 @@
+# test binary ops on locals whose operands or results don't fit in a small int
+
+def f(a, b):
+    print(a + b, a - b, a < b, a == b, a & b)
+    print(a + 1, a - 16, a < 47, a & 15)
+
+f(1 << 100, 1)
+f(2 ** 62, 2 ** 62)
+f(-2 ** 62, 2 ** 62)
+f(2 ** 30 - 1, 2 ** 30 - 1)
+f(-2 ** 30, 2 ** 30)
@@ -0,0 +1,23 @@
+# test that fused local and small int binary ops check for unbound locals
+
+def u(flag):
+    if flag:
+        x = 1
+    return x + 1
+
+print(u(True))
+try:
+    u(False)
+except NameError:
+    print('NameError')
+
+def v(flag):
+    if flag:
+        y = 1
+    z = 2
+    return z + y
+
+try:
+    v(False)
+except NameError:
+    print('NameError')
@@ -0,0 +1,15 @@
+import bench
+
+def test(num):
+    # Leave every other small object alive so the heap is full of one block
+    # holes that the allocator has to find.
+    keep = []
+    for i in range(2000):
+        keep.append((i, i))
+        x = [i, i, i, i, i, i]
+    for i in iter(range(num // 20)):
+        t = (i, i)
+        f = i / 3
+        s = "%d" % i
+
+bench.run(test)
@@ -0,0 +1,40 @@
+# test that buffers moved to make room in the long lived section still work
+
+import gc
+try:
+    import uctypes
+    gc.compact
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+def make(i):
+    class C:
+        data = bytes([i]) * 1000
+        def get(self):
+            return 42
+    return C
+
+# leave holes in the long lived section around the kept contents
+classes = [make(i) for i in range(32)]
+kept = [(c.data, c.get) for c in classes]
+classes = None
+gc.collect()
+before = [uctypes.addressof(d) for d, f in kept]
+
+# fill the heap so allocations fail and try to compact
+hold = []
+try:
+    while True:
+        hold.append(bytearray(4000))
+except MemoryError:
+    pass
+hold = None
+gc.collect()
+after = [uctypes.addressof(d) for d, f in kept]
+
+# some data moved, and only ever up towards the end of the heap
+print(any(a != b for a, b in zip(before, after)))
+print(all(a <= b for a, b in zip(before, after)))
+print(all(d == bytes([i]) * 1000 for i, (d, f) in enumerate(kept)))
+print(all(f(None) == 42 for d, f in kept))
@@ -0,0 +1,18 @@
+# test the allocation profile counters
+
+import gc
+
+try:
+    gc.stats
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+before = gc.stats()
+for i in range(100):
+    x = [i]
+after = gc.stats()
+print(after[0] - before[0] >= 100, after[1] - before[1] >= 100 * 4)
+
+gc.collect()
+print(gc.stats()[2] == after[2] + 1)
@@ -0,0 +1,42 @@
+# test the VM profile counters
+
+try:
+    import uprofile
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+def fib(n):
+    if n < 2:
+        return n
+    return fib(n - 1) + fib(n - 2)
+
+def gen():
+    yield 1
+    yield 2
+
+def run():
+    fib(10)
+    list(gen())
+    try:
+        fib(None)
+    except TypeError:
+        pass
+
+uprofile.reset()
+run()
+
+# calls count each run of the function, resuming a generator included
+functions = uprofile.functions()
+for name, file, line, calls, time in sorted(functions):
+    print(name, line, calls)
+times = [f[4] for f in functions]
+print(times == sorted(times, reverse=True))
+
+opcodes = dict(uprofile.opcodes())
+print(opcodes["RETURN_VALUE"] >= 177, opcodes["YIELD_VALUE"])
+counts = [o[1] for o in uprofile.opcodes()]
+print(counts == sorted(counts, reverse=True))
+
+uprofile.reset()
+print(uprofile.functions())
@@ -0,0 +1,56 @@
+# test that the bytecode of a running function stays put when compaction
+# moves the long lived data around it
+
+import gc
+try:
+    gc.compact
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+def churn():
+    # move what can move, then write over the space it left
+    gc.compact()
+    hold = []
+    try:
+        while True:
+            hold.append(b"\xff" * 64)
+    except MemoryError:
+        pass
+    hold = None
+
+# Making the class copies the methods' bytecode into the long lived section
+# next to the padding. Dropping the padding leaves holes above the bytecode
+# so compaction is free to move it.
+class C:
+    pad0 = bytes(100)
+    pad1 = bytes(100)
+    pad2 = bytes(100)
+    pad3 = bytes(100)
+    def run(self, n):
+        total = 0
+        for i in range(n):
+            if i == n // 2:
+                total += self.step(i)
+            total += i * 3
+        return total
+    pad4 = bytes(100)
+    pad5 = bytes(100)
+    def step(self, i):
+        churn()
+        return i * 7
+    pad6 = bytes(100)
+    pad7 = bytes(100)
+
+# Setting rather than deleting an attribute drops the reference to the
+# padding from the class dict.
+for i in range(8):
+    setattr(C, "pad%d" % i, None)
+gc.collect()
+
+# run and step are part way through when compaction happens, and in between
+# neither is running so their bytecode can move
+for _ in range(3):
+    print(C().run(20))
+    gc.compact()
+print(C().step(3))
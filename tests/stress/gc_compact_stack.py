@@ -0,0 +1,61 @@
+# test that data only referenced from the C stack stays put when compaction
+# moves the long lived data around it
+
+import gc
+try:
+    gc.compact
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+def churn():
+    # move what can move, then write over the space it left
+    gc.compact()
+    hold = []
+    try:
+        while True:
+            hold.append(b"\xff" * 64)
+    except MemoryError:
+        pass
+    hold = None
+
+def parts(n):
+    for i in range(n):
+        if i == 1:
+            churn()
+        yield b"-"
+
+# Making the class copies the separators into the long lived section next to
+# the padding. Dropping the padding leaves holes above their data so
+# compaction is free to move it.
+class C:
+    pad0 = bytes(100)
+    sep0 = b"A" * 40
+    pad1 = bytes(100)
+    sep1 = b"B" * 40
+    pad2 = bytes(100)
+    sep2 = b"C" * 40
+    pad3 = bytes(100)
+    sep3 = b"D" * 40
+    pad4 = bytes(100)
+
+# Setting rather than deleting an attribute drops the reference to the
+# padding from the class dict.
+for i in range(5):
+    setattr(C, "pad%d" % i, None)
+gc.collect()
+
+# str.join holds a pointer to the separator's data in a C local while the
+# generator runs
+for i in range(3):
+    for j, sep in enumerate((C.sep0, C.sep1, C.sep2, C.sep3)):
+        expect = bytes([65 + j]) * 40
+        print(sep.join(parts(3)) == b"-" + expect + b"-" + expect + b"-")
+    gc.compact()
+print(C.sep0 + C.sep1 + C.sep2 + C.sep3 == b"A" * 40 + b"B" * 40 + b"C" * 40 + b"D" * 40)
+
+# attribute names are interned, and the chunks holding them may move too
+for i in range(100):
+    setattr(C, "attr_%d_%s" % (i, "x" * (i % 30)), i)
+churn()
+print(all(getattr(C, "attr_%d_%s" % (i, "x" * (i % 30))) == i for i in range(100)))
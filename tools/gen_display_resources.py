@@ -114,10 +114,15 @@ _displayio_color_t terminal_colors[2] = {
     },
 };
 
+uint16_t terminal_converted_colors[2];
+
 displayio_palette_t supervisor_terminal_color = {
     .base = {.type = &displayio_palette_type },
     .colors = terminal_colors,
+    .converted_colors = terminal_converted_colors,
     .color_count = 2,
+    .transparent_count = 0,
+    .cache_valid = false,
     .needs_refresh = false
 };
 """)
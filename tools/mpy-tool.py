@@ -57,7 +57,7 @@ class FreezeError(Exception):
         return 'error while freezing %s: %s' % (self.rawcode.source_file, self.msg)
 
 class Config:
-    MPY_VERSION = 3
+    MPY_VERSION = 4
     MICROPY_LONGINT_IMPL_NONE = 0
     MICROPY_LONGINT_IMPL_LONGLONG = 1
     MICROPY_LONGINT_IMPL_MPZ = 2
@@ -68,10 +68,14 @@ MP_OPCODE_QSTR = 1
 MP_OPCODE_VAR_UINT = 2
 MP_OPCODE_OFFSET = 3
 
+# 2 extra bytes:
+MP_BC_LOAD_FAST_FAST_BINARY_OP = 0x48
+MP_BC_LOAD_FAST_CONST_BINARY_OP = 0x49
 # extra bytes:
 MP_BC_MAKE_CLOSURE = 0x62
 MP_BC_MAKE_CLOSURE_DEFARGS = 0x63
 MP_BC_RAISE_VARARGS = 0x5c
+MP_BC_FOR_RANGE = 0x4a
 # extra byte if caching enabled:
 MP_BC_LOAD_NAME = 0x1c
 MP_BC_LOAD_GLOBAL = 0x1d
@@ -118,7 +122,7 @@ def make_opcode_format():
     OC4(U, O, B, O), # 0x3c-0x3f
     OC4(O, B, B, O), # 0x40-0x43
     OC4(B, B, O, B), # 0x44-0x47
-    OC4(U, U, U, U), # 0x48-0x4b
+    OC4(B, B, O, U), # 0x48-0x4b
     OC4(U, U, U, U), # 0x4c-0x4f
     OC4(V, V, U, V), # 0x50-0x53
     OC4(B, U, V, V), # 0x54-0x57
@@ -184,6 +188,7 @@ def mp_opcode_format(bytecode, ip, opcode_format=make_opcode_format()):
             opcode == MP_BC_RAISE_VARARGS
             or opcode == MP_BC_MAKE_CLOSURE
             or opcode == MP_BC_MAKE_CLOSURE_DEFARGS
+            or opcode == MP_BC_FOR_RANGE
             or config.MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE and (
                 opcode == MP_BC_LOAD_NAME
                 or opcode == MP_BC_LOAD_GLOBAL
@@ -191,6 +196,8 @@ def mp_opcode_format(bytecode, ip, opcode_format=make_opcode_format()):
                 or opcode == MP_BC_STORE_ATTR
             )
         )
+        if opcode in (MP_BC_LOAD_FAST_FAST_BINARY_OP, MP_BC_LOAD_FAST_CONST_BINARY_OP):
+            extra_byte = 2
         ip += 1
         if f == MP_OPCODE_VAR_UINT:
             while bytecode[ip] & 0x80 != 0: